@@ -12,6 +12,7 @@
 // package include(s):
 #include <xAODAnaHelpers/HelperFunctions.h>
 #include <xAODAnaHelpers/BasicEventSelection.h>
+#include <xAODAnaHelpers/FileMetadataCache.h>
 
 #include "PATInterfaces/CorrectionCode.h"
 //#include "AsgTools/StatusCode.h"
@@ -32,6 +33,10 @@
 
 #include "xAODMetaData/FileMetaData.h"
 
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
 
 // this is needed to distribute the algorithm to the workers
 ClassImp(BasicEventSelection)
@@ -167,15 +172,6 @@ EL::StatusCode BasicEventSelection :: fileExecute ()
   m_event = wk()->xaodEvent();
   m_store = wk()->xaodStore();
 
-  // get the MetaData tree once a new file is opened, with
-  //
-  TTree* MetaData = dynamic_cast<TTree*>( wk()->inputFile()->Get("MetaData") );
-  if ( !MetaData ) {
-    ANA_MSG_ERROR( "MetaData tree not found! Exiting.");
-    return EL::StatusCode::FAILURE;
-  }
-  MetaData->LoadTree(0);
-
   //---------------------------
   // Meta data - CutBookkepers
   //---------------------------
@@ -183,106 +179,40 @@ EL::StatusCode BasicEventSelection :: fileExecute ()
   // Metadata for intial N (weighted) events are used to correctly normalise MC
   // if running on a MC DAOD which had some skimming applied at the derivation stage
 
-  //check if file is from a DxAOD
-  bool m_isDerivation = !MetaData->GetBranch("StreamAOD");
-
   if (  m_useMetaData ) {
 
-      // Check for potential file corruption
-      //
-      // If there are some Incomplete CBK, throw a WARNING,
-      // unless ALL of them have inputStream == "unknownStream"
-      //
-      const xAOD::CutBookkeeperContainer* incompleteCBC(nullptr);
-      if ( !m_event->retrieveMetaInput(incompleteCBC, "IncompleteCutBookkeepers").isSuccess() ) {
-	  ANA_MSG_ERROR("Failed to retrieve IncompleteCutBookkeepers from MetaData! Exiting.");
-	  return EL::StatusCode::FAILURE;
-      }
-      bool allFromUnknownStream(true);
-      if ( incompleteCBC->size() != 0 ) {
-
-	  std::string stream("");
-	  for ( auto cbk : *incompleteCBC ) {
-	      ANA_MSG_INFO("Incomplete cbk name: " << cbk->name() << " - stream: " << cbk->inputStream());
-	      if ( cbk->inputStream() != "unknownStream" ) {
-		  allFromUnknownStream = false;
-		  stream = cbk->inputStream();
-		  break;
-	      }
-	  }
-	  if ( !allFromUnknownStream ) { ANA_MSG_WARNING("Found incomplete CBK from stream: " << stream << ". This is not necessarily a sign of file corruption (incomplete CBK appear when 'maxevents' is set in the AOD jo, for instance), but you may still want to check input file for potential corruption..." ); }
-
+      if ( !m_metaDataCache ) {
+        m_metaDataCache = new FileMetadataCache();
+        if ( !m_metaDataCacheFile.empty() && m_metaDataCache->read(m_metaDataCacheFile) ) {
+          ANA_MSG_INFO( "Read " << m_metaDataCache->size() << " cached file summaries from " << m_metaDataCacheFile );
+        }
       }
 
-      // Now, let's find the actual information
+      // only open the MetaData tree of files that are not in the cache
       //
-      const xAOD::CutBookkeeperContainer* completeCBC(nullptr);
-      if ( !m_event->retrieveMetaInput(completeCBC, "CutBookkeepers").isSuccess() ) {
-	  ANA_MSG_ERROR("Failed to retrieve CutBookkeepers from MetaData! Exiting.");
-	  return EL::StatusCode::FAILURE;
-      }
-
-      // Find the smallest cycle number, the original first processing step/cycle
-      int minCycle(10000);
-      for ( auto cbk : *completeCBC ) {
-	  if ( !( cbk->name().empty() )  && ( minCycle > cbk->cycle() ) ){ minCycle = cbk->cycle(); }
-      }
-
-      // Now, let's actually find the right one that contains all the needed info...
-      const xAOD::CutBookkeeper* allEventsCBK(nullptr);
-      const xAOD::CutBookkeeper* DxAODEventsCBK(nullptr);
-
-      if ( m_isDerivation ) {
-	if(m_derivationName != ""){
-	  ANA_MSG_INFO("Override auto config to look at DAOD made by Derivation Algorithm: " << m_derivationName);
-	}else{
-	  ANA_MSG_INFO("Will autoconfig to look at DAOD made by Derivation Algorithm.");
-	}
-      }
-
-      int maxCycle(-1);
-      for ( const auto& cbk: *completeCBC ) {
-	  ANA_MSG_INFO("Complete cbk name: " << cbk->name() << " - stream: " << cbk->inputStream() );
-	  if ( cbk->cycle() > maxCycle && cbk->name() == "AllExecutedEvents" && cbk->inputStream() == "StreamAOD" ) {
-	      allEventsCBK = cbk;
-	      maxCycle = cbk->cycle();
-	  }
-	  if ( m_isDerivation ) {
-
-	    if(m_derivationName != ""){
-
-	      if ( cbk->name() == m_derivationName ) {
-		DxAODEventsCBK = cbk;
-	      }
-
-	    } else if( cbk->name().find("Kernel") != std::string::npos ){
-	      ANA_MSG_INFO("Auto config found DAOD made by Derivation Algorithm: " << cbk->name());
-	      DxAODEventsCBK = cbk;
-	    }
-
-	  } // is derivation
-      }
-
-      if(allEventsCBK == nullptr) {
-        ANA_MSG_WARNING("No allEventsCBK found (this is expected for DataScouting, otherwise not). Event numbers set to 0.");
-        m_MD_initialNevents     = 0;
-        m_MD_initialSumW        = 0;
-        m_MD_initialSumWSquared = 0;
-      }
-      else {
-        m_MD_initialNevents     = allEventsCBK->nAcceptedEvents();
-        m_MD_initialSumW        = allEventsCBK->sumOfEventWeights();
-        m_MD_initialSumWSquared = allEventsCBK->sumOfEventWeightsSquared();
-      }
+      const std::string fileName = wk()->inputFile()->GetName();
+      FileMetadataCache::Summary summary;
+      if ( !m_metaDataCacheFile.empty() && m_metaDataCache->find(fileName, m_derivationName, summary) ) {
+        ANA_MSG_INFO( "Using cached meta data of " << fileName );
+      } else {
+        TTree* MetaData = dynamic_cast<TTree*>( wk()->inputFile()->Get("MetaData") );
+        if ( !MetaData ) {
+          ANA_MSG_ERROR( "MetaData tree not found! Exiting.");
+          return EL::StatusCode::FAILURE;
+        }
+        MetaData->LoadTree(0);
 
-      if ( m_isDerivation && !DxAODEventsCBK ) {
-        ANA_MSG_ERROR( "No CutBookkeeper corresponds to the selected Derivation Framework algorithm name. Check it with your DF experts! Aborting.");
-        return EL::StatusCode::FAILURE;
+        m_metaDataCache->msg().setLevel( msg().level() );
+        ANA_CHECK( m_metaDataCache->summarize(m_event, MetaData, m_derivationName, summary) );
+        if ( !m_metaDataCacheFile.empty() ) m_metaDataCache->add(fileName, m_derivationName, summary);
       }
 
-      m_MD_finalNevents	      = ( m_isDerivation ) ? DxAODEventsCBK->nAcceptedEvents() : m_MD_initialNevents;
-      m_MD_finalSumW	      = ( m_isDerivation ) ? DxAODEventsCBK->sumOfEventWeights() : m_MD_initialSumW;
-      m_MD_finalSumWSquared   = ( m_isDerivation ) ? DxAODEventsCBK->sumOfEventWeightsSquared() : m_MD_initialSumWSquared;
+      m_MD_initialNevents     = summary.initialNevents;
+      m_MD_initialSumW        = summary.initialSumW;
+      m_MD_initialSumWSquared = summary.initialSumWSquared;
+      m_MD_finalNevents       = summary.finalNevents;
+      m_MD_finalSumW          = summary.finalSumW;
+      m_MD_finalSumWSquared   = summary.finalSumWSquared;
 
       // Write metadata event bookkeepers to histogram
       //
@@ -440,6 +370,7 @@ EL::StatusCode BasicEventSelection :: initialize ()
     m_cutflow_jetcleaning = m_cutflowHist->GetXaxis()->FindBin("JetCleaning");
     m_cutflowHistW->GetXaxis()->FindBin("JetCleaning");
   }
+  m_cutflowCounter.setHistograms( m_cutflowHist, m_cutflowHistW );
 
   ANA_MSG_INFO( "Histograms set up!");
 
@@ -456,6 +387,38 @@ EL::StatusCode BasicEventSelection :: initialize ()
 
   // -------------------------------------------------------------------------------------------------
 
+  // 0.
+  // load the event list
+  //
+
+  m_eventList.clear();
+  m_eventListRejected = 0;
+  if ( !m_eventListFile.empty() ) {
+    std::string eventListFile = PathResolverFindCalibFile(m_eventListFile);
+    std::ifstream eventList(eventListFile);
+    if ( !eventList ) {
+      ANA_MSG_ERROR( "Cannot open event list " << m_eventListFile );
+      return EL::StatusCode::FAILURE;
+    }
+
+    std::string line;
+    while ( std::getline(eventList, line) ) {
+      if ( line.empty() || line[0] == '#' ) continue;
+      std::istringstream fields(line);
+      uint32_t runNumber;
+      uint64_t eventNumber;
+      if ( !(fields >> runNumber >> eventNumber) ) {
+        ANA_MSG_ERROR( "Malformed line in event list " << m_eventListFile << ": " << line );
+        return EL::StatusCode::FAILURE;
+      }
+      m_eventList.emplace_back(runNumber, eventNumber);
+    }
+    std::sort(m_eventList.begin(), m_eventList.end());
+    m_eventList.erase(std::unique(m_eventList.begin(), m_eventList.end()), m_eventList.end());
+    m_eventList.shrink_to_fit();
+    ANA_MSG_INFO( "Only processing the " << m_eventList.size() << " events listed in " << eventListFile );
+  }
+
   ANA_MSG_INFO( "Setting Up Tools");
 
   // 1.
@@ -669,6 +632,16 @@ EL::StatusCode BasicEventSelection :: execute ()
   const xAOD::EventInfo* eventInfo(nullptr);
   ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
 
+  //------------------------------------------------------------------------------------------
+  // Skip events not in the event list before anything else is read
+  //------------------------------------------------------------------------------------------
+  if ( !m_eventListFile.empty() &&
+       !std::binary_search( m_eventList.begin(), m_eventList.end(), std::make_pair<uint32_t, uint64_t>(eventInfo->runNumber(), eventInfo->eventNumber()) ) ) {
+    ++m_eventListRejected;
+    wk()->skipEvent();
+    return EL::StatusCode::SUCCESS;
+  }
+
   //------------------------------------------------------------------------------------------
   // Declare an 'eventInfo' decorator with the MC event weight
   //------------------------------------------------------------------------------------------
@@ -728,8 +701,7 @@ EL::StatusCode BasicEventSelection :: execute ()
 
   if( !m_useMetaData )
     {
-      m_cutflowHist ->Fill( m_cutflow_all, 1 );
-      m_cutflowHistW->Fill( m_cutflow_all, mcEvtWeight);
+      m_cutflowCounter.fill( m_cutflow_all, mcEvtWeight );
 
       m_histEventCount -> Fill(1, 1);
       m_histEventCount -> Fill(2, 1);
@@ -739,21 +711,31 @@ EL::StatusCode BasicEventSelection :: execute ()
       m_histEventCount -> Fill(6, mcEvtWeight*mcEvtWeight);
     }
 
-  m_cutflowHist ->Fill( m_cutflow_init, 1 );
-  m_cutflowHistW->Fill( m_cutflow_init, mcEvtWeight);
+  m_cutflowCounter.fill( m_cutflow_init, mcEvtWeight );
 
   //--------------------------------------------------------------------------------------------------------
   // Check current event is not a duplicate
-  // This is done by checking against the std::set of <runNumber,eventNumber> filled for all previous events
+  // This is done by checking against the event numbers of the same run filled for all previous events
   //--------------------------------------------------------------------------------------------------------
 
   if ( ( !isMC() && m_checkDuplicatesData ) || ( isMC() && m_checkDuplicatesMC ) ) {
 
-    std::pair<uint32_t,uint32_t> thispair = std::make_pair(eventInfo->runNumber(),eventInfo->eventNumber());
+    uint32_t runNumber = eventInfo->runNumber();
+    auto runEvents = m_RunNr_VS_EvtNr.find(runNumber);
+    if ( runEvents == m_RunNr_VS_EvtNr.end() ) {
+      runEvents = m_RunNr_VS_EvtNr.emplace(runNumber, std::unordered_set<uint64_t>()).first;
+      m_duplicatesRunOrder.push_back(runNumber);
+      // release the oldest run once the window is full
+      if ( m_duplicatesRunWindow > 0 && m_duplicatesRunOrder.size() > m_duplicatesRunWindow ) {
+        ANA_MSG_DEBUG("Releasing the " << m_RunNr_VS_EvtNr[m_duplicatesRunOrder.front()].size() << " events of run " << m_duplicatesRunOrder.front() << " from the duplicate check");
+        m_RunNr_VS_EvtNr.erase(m_duplicatesRunOrder.front());
+        m_duplicatesRunOrder.pop_front();
+      }
+    }
 
-    if ( m_RunNr_VS_EvtNr.find(thispair) != m_RunNr_VS_EvtNr.end() ) {
+    if ( !runEvents->second.insert(eventInfo->eventNumber()).second ) {
 
-      ANA_MSG_WARNING("Found duplicated event! runNumber = " << static_cast<uint32_t>(eventInfo->runNumber()) << ", eventNumber = " << static_cast<uint32_t>(eventInfo->eventNumber()) << ". Skipping this event");
+      ANA_MSG_WARNING("Found duplicated event! runNumber = " << runNumber << ", eventNumber = " << eventInfo->eventNumber() << ". Skipping this event");
 
       // Bookkeep info in duplicates TTree
       //
@@ -766,10 +748,7 @@ EL::StatusCode BasicEventSelection :: execute ()
       return EL::StatusCode::SUCCESS; // go to next event
     }
 
-    m_RunNr_VS_EvtNr.insert(thispair);
-
-    m_cutflowHist ->Fill( m_cutflow_duplicates, 1 );
-    m_cutflowHistW->Fill( m_cutflow_duplicates, mcEvtWeight);
+    m_cutflowCounter.fill( m_cutflow_duplicates, mcEvtWeight );
 
   }
 
@@ -777,7 +756,10 @@ EL::StatusCode BasicEventSelection :: execute ()
   // Update Pile-Up Reweighting
   //------------------------------------------------------------------------------------------
   if ( m_doPUreweighting ) {
-    m_pileup_tool_handle->applySystematicVariation(CP::SystematicSet()).ignore();
+    if ( m_PUtoolVaried ) {
+      m_pileup_tool_handle->applySystematicVariation(CP::SystematicSet()).ignore();
+      m_PUtoolVaried = false;
+    }
     ANA_CHECK(m_pileup_tool_handle->apply( *eventInfo )); // NB: this call automatically decorates eventInfo with:
                                                  //  1.) the PU weight ("PileupWeight")
                                                  //  2.) the corrected mu ("corrected_averageInteractionsPerCrossing")
@@ -793,12 +775,25 @@ EL::StatusCode BasicEventSelection :: execute ()
     correctedAndScaledMu( *eventInfo ) = m_pileup_tool_handle->getCorrectedActualInteractionsPerCrossing( *eventInfo, true );
 
       if ( isMC() && m_doPUreweightingSys ) {
-       	CP::SystematicSet tmpSet;tmpSet.insert(CP::SystematicVariation("PRW_DATASF",1));
-      	m_pileup_tool_handle->applySystematicVariation( tmpSet ).ignore();
-	eventInfo->auxdecor< float >( "PileupWeight_UP" )= m_pileup_tool_handle->getCombinedWeight( *eventInfo );
-	tmpSet.clear();tmpSet.insert(CP::SystematicVariation("PRW_DATASF",-1));
-	m_pileup_tool_handle->applySystematicVariation( tmpSet ).ignore();
-	eventInfo->auxdecor< float >( "PileupWeight_DOWN")= m_pileup_tool_handle->getCombinedWeight( *eventInfo );
+	static SG::AuxElement::Decorator< float > weight_pileup_up  ("PileupWeight_UP");
+	static SG::AuxElement::Decorator< float > weight_pileup_down("PileupWeight_DOWN");
+
+	// the varied weights are computed (and the tool reconfigured) only for new (run, channel, mu) combinations
+	auto key = std::make_tuple( eventInfo->runNumber(), eventInfo->mcChannelNumber(),
+	                            eventInfo->averageInteractionsPerCrossing(), eventInfo->actualInteractionsPerCrossing() );
+	auto weights = m_PUweightSysCache.find( key );
+	if ( weights == m_PUweightSysCache.end() ) {
+	  CP::SystematicSet tmpSet;tmpSet.insert(CP::SystematicVariation("PRW_DATASF",1));
+	  m_pileup_tool_handle->applySystematicVariation( tmpSet ).ignore();
+	  float weightUp = m_pileup_tool_handle->getCombinedWeight( *eventInfo );
+	  tmpSet.clear();tmpSet.insert(CP::SystematicVariation("PRW_DATASF",-1));
+	  m_pileup_tool_handle->applySystematicVariation( tmpSet ).ignore();
+	  float weightDown = m_pileup_tool_handle->getCombinedWeight( *eventInfo );
+	  m_PUtoolVaried = true;
+	  weights = m_PUweightSysCache.emplace( key, std::make_pair(weightUp, weightDown) ).first;
+	}
+	weight_pileup_up  ( *eventInfo ) = weights->second.first;
+	weight_pileup_down( *eventInfo ) = weights->second.second;
       }
   }
 
@@ -825,20 +820,33 @@ EL::StatusCode BasicEventSelection :: execute ()
   if ( !isMC() ) {
 
     // Get the streams that the event was put in
-    const std::vector<  xAOD::EventInfo::StreamTag > streams = eventInfo->streamTags();
+    if ( msgLvl(MSG::DEBUG) ) {
+      for ( auto& stream : eventInfo->streamTags() ) {
+        ANA_MSG_DEBUG( "event has fired stream: " << stream.name() );
+      }
+    }
 
-    for ( auto& stream : streams ) {
-      ANA_MSG_DEBUG( "event has fired stream: " << stream.name() );
+    // Lumi-block scoped decisions only change when the (run, lumi block) changes,
+    // which happens rarely in data since consecutive events share it
+    uint32_t runNumber   = eventInfo->runNumber();
+    uint32_t lumiBlockNr = eventInfo->lumiBlock();
+    if ( !m_currentLumiBlock || runNumber != m_currentRunNumber || lumiBlockNr != m_currentLumiBlockNr ) {
+      auto lumiBlock = m_lumiBlocks.emplace( std::make_pair(runNumber, lumiBlockNr), LumiBlockInfo{true, 0, 0.} );
+      if ( lumiBlock.second && m_applyGRLCut ) lumiBlock.first->second.passGRL = m_grl_handle->passRunLB( runNumber, lumiBlockNr );
+      m_currentLumiBlock   = &lumiBlock.first->second;
+      m_currentRunNumber   = runNumber;
+      m_currentLumiBlockNr = lumiBlockNr;
     }
+    m_currentLumiBlock->nEvents++;
+    m_currentLumiBlock->sumOfWeights += mcEvtWeight;
 
     // GRL
     if ( m_applyGRLCut ) {
-      if ( !m_grl_handle->passRunLB( *eventInfo ) ) {
+      if ( !m_currentLumiBlock->passGRL ) {
         wk()->skipEvent();
         return EL::StatusCode::SUCCESS; // go to next event
       }
-      m_cutflowHist ->Fill( m_cutflow_grl, 1 );
-      m_cutflowHistW->Fill( m_cutflow_grl, mcEvtWeight);
+      m_cutflowCounter.fill( m_cutflow_grl, mcEvtWeight );
     }
 
     //------------------------------------------------------------
@@ -851,29 +859,25 @@ EL::StatusCode BasicEventSelection :: execute ()
       wk()->skipEvent();
       return EL::StatusCode::SUCCESS;
     }
-    m_cutflowHist ->Fill( m_cutflow_lar, 1 );
-    m_cutflowHistW->Fill( m_cutflow_lar, mcEvtWeight);
+    m_cutflowCounter.fill( m_cutflow_lar, mcEvtWeight );
 
     if ( m_applyEventCleaningCut && (eventInfo->errorState(xAOD::EventInfo::Tile)==xAOD::EventInfo::Error ) ) {
       wk()->skipEvent();
       return EL::StatusCode::SUCCESS;
     }
-    m_cutflowHist ->Fill( m_cutflow_tile, 1 );
-    m_cutflowHistW->Fill( m_cutflow_tile, mcEvtWeight);
+    m_cutflowCounter.fill( m_cutflow_tile, mcEvtWeight );
 
     if ( m_applyEventCleaningCut && (eventInfo->errorState(xAOD::EventInfo::SCT)==xAOD::EventInfo::Error) ) {
       wk()->skipEvent();
       return EL::StatusCode::SUCCESS;
     }
-    m_cutflowHist ->Fill( m_cutflow_SCT, 1 );
-    m_cutflowHistW->Fill( m_cutflow_SCT, mcEvtWeight);
+    m_cutflowCounter.fill( m_cutflow_SCT, mcEvtWeight );
 
     if ( m_applyCoreFlagsCut && (eventInfo->isEventFlagBitSet(xAOD::EventInfo::Core, 18) ) ) {
       wk()->skipEvent();
       return EL::StatusCode::SUCCESS;
     }
-    m_cutflowHist ->Fill( m_cutflow_core, 1 );
-    m_cutflowHistW->Fill( m_cutflow_core, mcEvtWeight);
+    m_cutflowCounter.fill( m_cutflow_core, mcEvtWeight );
 
   }
 
@@ -884,8 +888,7 @@ EL::StatusCode BasicEventSelection :: execute ()
 	return EL::StatusCode::SUCCESS;
       }
   }
-  m_cutflowHist ->Fill( m_cutflow_jetcleaning, 1 );
-  m_cutflowHistW->Fill( m_cutflow_jetcleaning, mcEvtWeight);
+  m_cutflowCounter.fill( m_cutflow_jetcleaning, mcEvtWeight );
 
   // n.b. this cut should only be applied in 2015+16 data, and not to MC!
   // details here: https://twiki.cern.ch/twiki/bin/viewauth/AtlasProtected/HowToCleanJets2017#IsBadBatMan_Event_Flag_and_EMEC
@@ -895,8 +898,7 @@ EL::StatusCode BasicEventSelection :: execute ()
       return EL::StatusCode::SUCCESS;
     }
   }
-  m_cutflowHist ->Fill( m_cutflow_isbadbatman, 1 );
-  m_cutflowHistW->Fill( m_cutflow_isbadbatman, mcEvtWeight);
+  m_cutflowCounter.fill( m_cutflow_isbadbatman, mcEvtWeight );
 
   //-----------------------------
   // Primary Vertex 'quality' cut
@@ -911,8 +913,7 @@ EL::StatusCode BasicEventSelection :: execute ()
       return EL::StatusCode::SUCCESS;
     }
   }
-  m_cutflowHist ->Fill( m_cutflow_npv, 1 );
-  m_cutflowHistW->Fill( m_cutflow_npv, mcEvtWeight);
+  m_cutflowCounter.fill( m_cutflow_npv, mcEvtWeight );
 
   //---------------------
   // Trigger decision cut
@@ -920,7 +921,8 @@ EL::StatusCode BasicEventSelection :: execute ()
 
   if ( !m_triggerSelection.empty() || m_storeTrigDecisions ) {
 
-    auto triggerChainGroup = m_trigDecTool_handle->getChainGroup(m_triggerSelection);
+    resolveTriggerChains();
+    const Trig::ChainGroup* triggerChainGroup = m_triggerChainGroup;
 
     if ( m_applyTriggerCut ) {
 
@@ -928,8 +930,7 @@ EL::StatusCode BasicEventSelection :: execute ()
         wk()->skipEvent();
         return EL::StatusCode::SUCCESS;
       }
-      m_cutflowHist ->Fill( m_cutflow_trigger, 1 );
-      m_cutflowHistW->Fill( m_cutflow_trigger, mcEvtWeight);
+      m_cutflowCounter.fill( m_cutflow_trigger, mcEvtWeight );
 
     }
 
@@ -946,14 +947,14 @@ EL::StatusCode BasicEventSelection :: execute ()
 
       // Save info for the triggers used to skim events
       //
-      for ( auto &trigName : triggerChainGroup->getListOfTriggers() ) {
-        auto trigChain = m_trigDecTool_handle->getChainGroup( trigName );
+      for ( const TriggerChain& chain : m_selectionChains ) {
+        const std::string& trigName = chain.name;
+        const Trig::ChainGroup* trigChain = chain.chainGroup;
         if ( trigChain->isPassed() ) {
           passedTriggers.push_back( trigName );
           triggerPrescales.push_back( trigChain->getPrescale() );
 
-          bool doLumiPrescale = std::find(m_triggerUnprescaleList.begin(), m_triggerUnprescaleList.end(), trigName) != m_triggerUnprescaleList.end();
-          if ( doLumiPrescale ) {
+          if ( chain.lumiPrescale ) {
             triggerPrescalesLumi.push_back( m_pileup_tool_handle->getDataWeight( *eventInfo, trigName, true ) );
           } else {
             triggerPrescalesLumi.push_back( -1 );
@@ -968,17 +969,14 @@ EL::StatusCode BasicEventSelection :: execute ()
       //
       if ( !m_extraTriggerSelection.empty() ) {
 
-	for ( const std::string &trigName : m_extraTriggerSelectionList ) {
-	  auto trigChain = m_trigDecTool_handle->getChainGroup( trigName );
+	for ( const TriggerChain& chain : m_extraChains ) {
+	  const std::string& trigName = chain.name;
+	  const Trig::ChainGroup* trigChain = chain.chainGroup;
 	  if ( trigChain->isPassed() ) {
 	    passedTriggers.push_back( trigName );
 	    triggerPrescales.push_back( trigChain->getPrescale() );
 
-      bool doLumiPrescale = true;
-      for ( const std::string &trigPart : trigChain->getListOfTriggers() ) {
-        if (std::find(m_triggerUnprescaleList.begin(), m_triggerUnprescaleList.end(), trigPart) == m_triggerUnprescaleList.end()) doLumiPrescale = false;
-      }
-      if ( doLumiPrescale ) {
+      if ( chain.lumiPrescale ) {
         triggerPrescalesLumi.push_back( m_pileup_tool_handle->getDataWeight( *eventInfo, trigName, true ) );
       } else {
         triggerPrescalesLumi.push_back( -1 );
@@ -1010,11 +1008,11 @@ EL::StatusCode BasicEventSelection :: execute ()
 
     if ( m_storePassL1 ) {
       static SG::AuxElement::Decorator< int > passL1("passL1");
-      passL1(*eventInfo)  = ( m_triggerSelection.find("L1_") != std::string::npos )  ? (int)m_trigDecTool_handle->isPassed(m_triggerSelection.c_str()) : -1;
+      passL1(*eventInfo)  = ( m_triggerSelection.find("L1_") != std::string::npos )  ? (int)triggerChainGroup->isPassed() : -1;
     }
     if ( m_storePassHLT ) {
       static SG::AuxElement::Decorator< int > passHLT("passHLT");
-      passHLT(*eventInfo) = ( m_triggerSelection.find("HLT_") != std::string::npos ) ? (int)m_trigDecTool_handle->isPassed(m_triggerSelection.c_str()) : -1;
+      passHLT(*eventInfo) = ( m_triggerSelection.find("HLT_") != std::string::npos ) ? (int)triggerChainGroup->isPassed() : -1;
     }
 
   } // if giving a specific list of triggers to look at
@@ -1307,7 +1305,39 @@ EL::StatusCode BasicEventSelection :: finalize ()
 
   ANA_MSG_INFO( "Number of processed events \t= " << m_eventCounter);
 
+  m_cutflowCounter.materialize();
+  if ( !m_eventListFile.empty() ) ANA_MSG_INFO( "Events not in the event list \t= " << m_eventListRejected);
+
   m_RunNr_VS_EvtNr.clear();
+  m_duplicatesRunOrder.clear();
+
+  if ( m_storeLumiBlockCutflow && !m_lumiBlocks.empty() ) {
+    TFile *fileCF = wk()->getOutputFile (m_cutFlowStreamName);
+    fileCF->cd();
+
+    UInt_t    runNumber, lumiBlock;
+    Bool_t    passGRL;
+    ULong64_t nEvents;
+    Double_t  sumOfWeights;
+    TTree* lumiBlocks = new TTree("lumiBlocks","Processed events per lumi block");
+    lumiBlocks->Branch("runNumber",    &runNumber,    "runNumber/i");
+    lumiBlocks->Branch("lumiBlock",    &lumiBlock,    "lumiBlock/i");
+    lumiBlocks->Branch("passGRL",      &passGRL,      "passGRL/O");
+    lumiBlocks->Branch("nEvents",      &nEvents,      "nEvents/l");
+    lumiBlocks->Branch("sumOfWeights", &sumOfWeights, "sumOfWeights/D");
+    for ( const auto& lb : m_lumiBlocks ) {
+      runNumber    = lb.first.first;
+      lumiBlock    = lb.first.second;
+      passGRL      = lb.second.passGRL;
+      nEvents      = lb.second.nEvents;
+      sumOfWeights = lb.second.sumOfWeights;
+      lumiBlocks->Fill();
+    }
+    lumiBlocks->ResetBranchAddresses();
+  }
+  m_lumiBlocks.clear();
+  m_currentLumiBlock = nullptr;
+  m_PUweightSysCache.clear();
 
   if ( m_trigDecTool_handle.isInitialized() ){
     if (asg::ToolStore::contains<Trig::TrigDecisionTool>("ToolSvc.TrigDecisionTool") ){
@@ -1338,6 +1368,55 @@ EL::StatusCode BasicEventSelection :: histFinalize ()
   // outputs have been merged.  This is different from finalize() in
   // that it gets called on all worker nodes regardless of whether
   // they processed input events.
+
+  if ( m_metaDataCache ) {
+    if ( m_metaDataCache->modified() ) {
+      // pick up what other jobs added in the meantime, then write everything back
+      FileMetadataCache cache;
+      cache.read(m_metaDataCacheFile);
+      cache.merge(*m_metaDataCache);
+      ANA_MSG_INFO( "Writing " << cache.size() << " file summaries to " << m_metaDataCacheFile );
+      if ( !cache.write(m_metaDataCacheFile) ) {
+        ANA_MSG_WARNING( "Could not write the meta data cache " << m_metaDataCacheFile );
+      }
+    }
+    delete m_metaDataCache;
+    m_metaDataCache = nullptr;
+  }
+
   ANA_CHECK( xAH::Algorithm::algFinalize());
   return EL::StatusCode::SUCCESS;
 }
+
+void BasicEventSelection::resolveTriggerChains()
+{
+  uint32_t masterKey = m_trigConfTool_handle->masterKey();
+  uint32_t L1PSKey   = m_trigConfTool_handle->lvl1PrescaleKey();
+  uint32_t HLTPSKey  = m_trigConfTool_handle->hltPrescaleKey();
+  if ( m_triggerChainGroup && masterKey == m_trigMasterKey && L1PSKey == m_trigL1PSKey && HLTPSKey == m_trigHLTPSKey ) return;
+
+  ANA_MSG_DEBUG( "Resolving trigger chain groups for keys " << masterKey << "/" << L1PSKey << "/" << HLTPSKey );
+  m_trigMasterKey = masterKey;
+  m_trigL1PSKey   = L1PSKey;
+  m_trigHLTPSKey  = HLTPSKey;
+
+  m_triggerChainGroup = m_trigDecTool_handle->getChainGroup(m_triggerSelection);
+  m_selectionChains.clear();
+  m_extraChains.clear();
+  if ( !m_storeTrigDecisions ) return;
+
+  std::set<std::string> unprescaled( m_triggerUnprescaleList.begin(), m_triggerUnprescaleList.end() );
+
+  for ( const std::string& trigName : m_triggerChainGroup->getListOfTriggers() ) {
+    m_selectionChains.push_back( { trigName, m_trigDecTool_handle->getChainGroup( trigName ), unprescaled.count( trigName ) > 0 } );
+  }
+
+  for ( const std::string& trigName : m_extraTriggerSelectionList ) {
+    const Trig::ChainGroup* chainGroup = m_trigDecTool_handle->getChainGroup( trigName );
+    bool lumiPrescale = true;
+    for ( const std::string& trigPart : chainGroup->getListOfTriggers() ) {
+      if ( !unprescaled.count( trigPart ) ) lumiPrescale = false;
+    }
+    m_extraChains.push_back( { trigName, chainGroup, lumiPrescale } );
+  }
+}
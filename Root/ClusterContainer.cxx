@@ -21,6 +21,7 @@ void ClusterContainer::setTree(TTree *tree)
   ParticleContainer::setTree(tree);
   tree->SetBranchStatus  ("nclus" , 1);
   tree->SetBranchAddress ("nclus" , &m_n);
+  if ( m_lazy ) return;
 }
 
 void ClusterContainer::updateParticle(uint idx, Cluster& cluster)
@@ -0,0 +1,84 @@
+#include "xAODAnaHelpers/CutflowCounter.h"
+
+#include <TArrayD.h>
+
+xAH::CutflowCounter::CutflowCounter() :
+  m_hist(nullptr),
+  m_histW(nullptr),
+  m_nBins(0)
+{
+}
+
+void xAH::CutflowCounter::setHistograms(TH1D* hist, TH1D* histW)
+{
+  m_hist  = hist;
+  m_histW = histW;
+  // including under- and overflow
+  m_nBins = hist ? hist->GetNbinsX()+2 : 0;
+  m_bins.reset( m_nBins ? new Bin[m_nBins] : nullptr );
+}
+
+void xAH::CutflowCounter::fill(int bin, double weight)
+{
+  if( bin < 0 || bin >= m_nBins ) {
+    // a bin labelled after setHistograms, count it the slow way
+    if( m_hist  ) m_hist ->Fill( bin, 1 );
+    if( m_histW ) m_histW->Fill( bin, weight );
+    return;
+  }
+
+  Bin& counts = m_bins[bin];
+  counts.n.fetch_add(1, std::memory_order_relaxed);
+  if( m_histW ) {
+    add(counts.sumW,  weight);
+    add(counts.sumW2, weight*weight);
+  }
+}
+
+void xAH::CutflowCounter::materialize()
+{
+  if( !m_hist ) return;
+
+  unsigned long long nTotal(0);
+  bool weighted(false);
+  for( int bin = 0; bin < m_nBins; ++bin ) {
+    nTotal += m_bins[bin].n;
+    if( m_bins[bin].sumW2 != m_bins[bin].n ) weighted = true;
+  }
+  if( nTotal == 0 ) return;
+
+  // same errors as filling entry by entry would have given
+  if( m_histW && weighted && !m_histW->GetSumw2N() ) m_histW->Sumw2();
+
+  double entries  = m_hist->GetEntries();
+  double entriesW = m_histW ? m_histW->GetEntries() : 0.;
+  for( int bin = 0; bin < m_nBins; ++bin ) {
+    Bin& counts = m_bins[bin];
+    if( counts.n == 0 ) continue;
+
+    m_hist->AddBinContent( bin, counts.n );
+    if( m_hist->GetSumw2N() ) m_hist->GetSumw2()->fArray[bin] += counts.n;
+
+    if( m_histW ) {
+      m_histW->AddBinContent( bin, counts.sumW );
+      if( m_histW->GetSumw2N() ) m_histW->GetSumw2()->fArray[bin] += counts.sumW2;
+    }
+
+    counts.n = 0;
+    counts.sumW = 0.;
+    counts.sumW2 = 0.;
+  }
+
+  m_hist->ResetStats();
+  m_hist->SetEntries( entries + nTotal );
+  if( m_histW ) {
+    m_histW->ResetStats();
+    m_histW->SetEntries( entriesW + nTotal );
+  }
+}
+
+void xAH::CutflowCounter::add(std::atomic<double>& sum, double value)
+{
+  double current = sum.load(std::memory_order_relaxed);
+  while( !sum.compare_exchange_weak(current, current + value, std::memory_order_relaxed) ) {}
+}
@@ -190,6 +190,7 @@ void ElectronContainer::setTree(TTree *tree)
   //
   // Connect branches
   ParticleContainer::setTree(tree);
+  if ( m_lazy ) return;
 
   if ( m_infoSwitch.m_kinematic ) {
     connectBranch<float>(tree,"caloCluster_eta", &m_caloCluster_eta);
@@ -202,6 +203,10 @@ void ElectronContainer::setTree(TTree *tree)
     connectBranch<std::string> (tree,"listTrigChains",       &m_listTrigChains);
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    connectTrigMatchMaskBranch(tree);
+  }
+
   if ( m_infoSwitch.m_isolation ) {
     for (auto& isol : m_infoSwitch.m_isolWPs) {
       if (!isol.empty() && isol != "NONE") {
@@ -233,7 +238,23 @@ void ElectronContainer::setTree(TTree *tree)
     }
   }
 
-  if ( m_infoSwitch.m_effSF && m_mc ) {
+  if ( m_infoSwitch.m_effSF && m_mc && m_infoSwitch.m_effSFFlat ) {
+    for (auto& PID : m_infoSwitch.m_PIDSFWPs) {
+      connectFlatSFBranch(tree, "PIDEff_SF_" + PID);
+
+      for (auto& isol : m_infoSwitch.m_isolWPs) {
+        if(!isol.empty())
+          connectFlatSFBranch(tree, "IsoEff_SF_" + PID + "_isol" + isol);
+        for (auto& trig : m_infoSwitch.m_trigWPs) {
+          connectFlatSFBranch(tree, "TrigEff_SF_" + trig + "_" + PID + (!isol.empty() ? "_isol" + isol : ""));
+          connectFlatSFBranch(tree, "TrigMCEff_"  + trig + "_" + PID + (!isol.empty() ? "_isol" + isol : ""));
+        }
+      }
+    }
+
+    connectFlatSFBranch(tree, "RecoEff_SF");
+  }
+  else if ( m_infoSwitch.m_effSF && m_mc ) {
     for (auto& PID : m_infoSwitch.m_PIDSFWPs) {
       tree->SetBranchStatus ( (m_name+"_PIDEff_SF_" + PID).c_str() , 1);
       tree->SetBranchAddress( (m_name+"_PIDEff_SF_" + PID).c_str() , & (*m_PIDEff_SF)[ PID ] );
@@ -318,6 +339,10 @@ void ElectronContainer::updateParticle(uint idx, Electron& elec)
     elec.listTrigChains        =     m_listTrigChains        ->at(idx);
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    elec.trigMatchMask         =     m_trigMatchMask         ->at(idx);
+  }
+
   // isolation
   if ( m_infoSwitch.m_isolation ) {
     for (auto& isol : m_infoSwitch.m_isolWPs) {
@@ -351,7 +376,26 @@ void ElectronContainer::updateParticle(uint idx, Electron& elec)
 
   // scale factors w/ sys
   // per object
-  if ( m_infoSwitch.m_effSF && m_mc ) {
+  if ( m_infoSwitch.m_effSF && m_mc && m_infoSwitch.m_effSFFlat ) {
+
+    // in the order of connectFlatSFBranch in setTree
+    unsigned int iSF = 0;
+    for (auto& PID : m_infoSwitch.m_PIDSFWPs) {
+      elec.PIDEff_SF[ PID ] = flatSF(*m_flatSFOrder[iSF++], idx);
+      for (auto& iso : m_infoSwitch.m_isolWPs) {
+        if(!iso.empty())
+          elec.IsoEff_SF[ PID+iso ] = flatSF(*m_flatSFOrder[iSF++], idx);
+        for (auto& trig : m_infoSwitch.m_trigWPs) {
+          elec.TrigEff_SF[ trig+PID+iso ] = flatSF(*m_flatSFOrder[iSF++], idx);
+          elec.TrigMCEff [ trig+PID+iso ] = flatSF(*m_flatSFOrder[iSF++], idx);
+        }
+      }
+    }
+
+    elec.RecoEff_SF = flatSF(*m_flatSFOrder[iSF++], idx);
+
+  }
+  else if ( m_infoSwitch.m_effSF && m_mc ) {
 
     for (auto& PID : m_infoSwitch.m_PIDSFWPs) {
       elec.PIDEff_SF[ PID ] = (*m_PIDEff_SF) [ PID ].at(idx);
@@ -435,6 +479,11 @@ void ElectronContainer::setBranches(TTree *tree)
     setBranch<std::string> (tree,"listTrigChains",       m_listTrigChains);
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    // one bit per chain, the chain names are stored once in the tree UserInfo
+    setTrigMatchMaskBranch(tree);
+  }
+
   if ( m_infoSwitch.m_isolation ) {
     for (auto& isol : m_infoSwitch.m_isolWPs) {
       if (!isol.empty() && isol != "NONE") {
@@ -464,7 +513,22 @@ void ElectronContainer::setBranches(TTree *tree)
     }
   }
 
-  if ( m_infoSwitch.m_effSF && m_mc ) {
+  if ( m_infoSwitch.m_effSF && m_mc && m_infoSwitch.m_effSFFlat ) {
+    for (auto& PID : m_infoSwitch.m_PIDSFWPs) {
+      setFlatSFBranch(tree, "PIDEff_SF_" + PID);
+      for (auto& isol : m_infoSwitch.m_isolWPs) {
+        if(!isol.empty())
+          setFlatSFBranch(tree, "IsoEff_SF_" + PID + "_isol" + isol);
+        for (auto& trig : m_infoSwitch.m_trigWPs) {
+          setFlatSFBranch(tree, "TrigEff_SF_" + trig + "_" + PID + (!isol.empty() ? "_isol" + isol : ""));
+          setFlatSFBranch(tree, "TrigMCEff_"  + trig + "_" + PID + (!isol.empty() ? "_isol" + isol : ""));
+        }
+      }
+    }
+
+    setFlatSFBranch(tree, "RecoEff_SF");
+  }
+  else if ( m_infoSwitch.m_effSF && m_mc ) {
     for (auto& PID : m_infoSwitch.m_PIDSFWPs) {
       tree->Branch( (m_name+"_PIDEff_SF_"  + PID).c_str() , & (*m_PIDEff_SF)[ PID ] );
       for (auto& isol : m_infoSwitch.m_isolWPs) {
@@ -545,6 +609,10 @@ void ElectronContainer::clear()
     m_listTrigChains              ->clear();
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    m_trigMatchMask->clear();
+  }
+
   if ( m_infoSwitch.m_isolation ) {
     for (auto& isol : m_infoSwitch.m_isolWPs) {
       (*m_isIsolated)[ isol ].clear();
@@ -570,7 +638,10 @@ void ElectronContainer::clear()
     }
   }
 
-  if ( m_infoSwitch.m_effSF && m_mc ) {
+  if ( m_infoSwitch.m_effSF && m_mc && m_infoSwitch.m_effSFFlat ) {
+    clearFlatSFs();
+  }
+  else if ( m_infoSwitch.m_effSF && m_mc ) {
 
     for (auto& PID : m_infoSwitch.m_PIDSFWPs) {
       (*m_PIDEff_SF)[ PID ].clear();
@@ -655,6 +726,11 @@ void ElectronContainer::FillElectron( const xAOD::IParticle* particle, const xAO
     m_charge->push_back( elec->charge() );
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    static SG::AuxElement::ConstAccessor< std::map<std::string,char> > acc_isTrigMatchedMap("isTrigMatchedMapEl");
+    fillTrigMatchMask( acc_isTrigMatchedMap.isAvailable( *elec ) ? &acc_isTrigMatchedMap( *elec ) : nullptr );
+  }
+
   if ( m_infoSwitch.m_trigger ) {
 
     // retrieve map<string,char> w/ <chain,isMatched>
@@ -832,6 +908,9 @@ void ElectronContainer::FillElectron( const xAOD::IParticle* particle, const xAO
     std::vector<float> junkSF(1,-1.0);
     std::vector<float> junkEff(1,-1.0);
 
+    // in the order of setFlatSFBranch in setBranches
+    unsigned int iSF = 0;
+
     static std::map< std::string, SG::AuxElement::Accessor< std::vector< float > > > accPIDSF;
     static std::map< std::string, SG::AuxElement::Accessor< std::vector< float > > > accIsoSF;
     static std::map< std::string, SG::AuxElement::Accessor< std::vector< float > > > accTrigSF;
@@ -840,25 +919,29 @@ void ElectronContainer::FillElectron( const xAOD::IParticle* particle, const xAO
     for (auto& PID : m_infoSwitch.m_PIDSFWPs) {
       std::string PIDSF = "ElPIDEff_SF_syst_" + PID;
       accPIDSF.insert( std::pair<std::string, SG::AuxElement::Accessor< std::vector< float > > > ( PID , SG::AuxElement::Accessor< std::vector< float > >( PIDSF ) ) );
-      safeSFVecFill<float, xAOD::Electron>( elec, accPIDSF.at( PID ), &m_PIDEff_SF->at( PID ), junkSF );
+      if ( m_infoSwitch.m_effSFFlat ) fillFlatSF( elec, accPIDSF.at( PID ), *m_flatSFOrder[iSF++], m_infoSwitch.m_effSFQuant );
+      else safeSFVecFill<float, xAOD::Electron>( elec, accPIDSF.at( PID ), &m_PIDEff_SF->at( PID ), junkSF );
 
       for (auto& isol : m_infoSwitch.m_isolWPs) {
 
         if(!isol.empty()) {
           std::string IsoSF = "ElIsoEff_SF_syst_" + PID + "_isol" + isol;
           accIsoSF.insert( std::pair<std::string, SG::AuxElement::Accessor< std::vector< float > > > ( PID+isol , SG::AuxElement::Accessor< std::vector< float > >( IsoSF ) ) );
-          safeSFVecFill<float, xAOD::Electron>( elec, accIsoSF.at( PID+isol ), &m_IsoEff_SF->at( PID+isol ), junkSF );
+          if ( m_infoSwitch.m_effSFFlat ) fillFlatSF( elec, accIsoSF.at( PID+isol ), *m_flatSFOrder[iSF++], m_infoSwitch.m_effSFQuant );
+          else safeSFVecFill<float, xAOD::Electron>( elec, accIsoSF.at( PID+isol ), &m_IsoEff_SF->at( PID+isol ), junkSF );
         }
 
         for (auto& trig : m_infoSwitch.m_trigWPs) {
 
           std::string TrigSF = "ElTrigEff_SF_syst_" + trig + "_" + PID + (!isol.empty() ? "_isol" + isol : "");
           accTrigSF.insert( std::pair<std::string, SG::AuxElement::Accessor< std::vector< float > > > ( trig+PID+isol , SG::AuxElement::Accessor< std::vector< float > >( TrigSF ) ) );
-          safeSFVecFill<float, xAOD::Electron>( elec, accTrigSF.at( trig+PID+isol ), &m_TrigEff_SF->at( trig+PID+isol ), junkSF );
+          if ( m_infoSwitch.m_effSFFlat ) fillFlatSF( elec, accTrigSF.at( trig+PID+isol ), *m_flatSFOrder[iSF++], m_infoSwitch.m_effSFQuant );
+          else safeSFVecFill<float, xAOD::Electron>( elec, accTrigSF.at( trig+PID+isol ), &m_TrigEff_SF->at( trig+PID+isol ), junkSF );
 
           std::string TrigEFF = "ElTrigMCEff_syst_" + trig + "_" + PID + (!isol.empty() ? "_isol" + isol : "");
           accTrigEFF.insert( std::pair<std::string, SG::AuxElement::Accessor< std::vector< float > > > ( trig+PID+isol , SG::AuxElement::Accessor< std::vector< float > >( TrigEFF ) ) );
-          safeSFVecFill<float, xAOD::Electron>( elec, accTrigEFF.at( trig+PID+isol ), &m_TrigMCEff->at( trig+PID+isol ), junkSF );
+          if ( m_infoSwitch.m_effSFFlat ) fillFlatSF( elec, accTrigEFF.at( trig+PID+isol ), *m_flatSFOrder[iSF++], m_infoSwitch.m_effSFQuant );
+          else safeSFVecFill<float, xAOD::Electron>( elec, accTrigEFF.at( trig+PID+isol ), &m_TrigMCEff->at( trig+PID+isol ), junkSF );
 
         }
 
@@ -866,7 +949,8 @@ void ElectronContainer::FillElectron( const xAOD::IParticle* particle, const xAO
     }
 
    static SG::AuxElement::Accessor< std::vector< float > > accRecoSF("ElRecoEff_SF_syst_Reconstruction");
-   safeSFVecFill<float, xAOD::Electron>( elec, accRecoSF, m_RecoEff_SF, junkSF );
+   if ( m_infoSwitch.m_effSFFlat ) fillFlatSF( elec, accRecoSF, *m_flatSFOrder[iSF++], m_infoSwitch.m_effSFQuant );
+   else safeSFVecFill<float, xAOD::Electron>( elec, accRecoSF, m_RecoEff_SF, junkSF );
  }
 
   return;
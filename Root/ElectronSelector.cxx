@@ -159,6 +159,7 @@ EL::StatusCode ElectronSelector :: initialize ()
     m_el_cutflow_BL_cut          = m_el_cutflowHist_1->GetXaxis()->FindBin("BL_cut");
     m_el_cutflow_PID_cut         = m_el_cutflowHist_1->GetXaxis()->FindBin("PID_cut");
     m_el_cutflow_iso_cut         = m_el_cutflowHist_1->GetXaxis()->FindBin("iso_cut");
+    m_el_cutflowCounter_1.setHistograms( m_el_cutflowHist_1 );
 
     if ( m_isUsedBefore ) {
       m_el_cutflowHist_2 = (TH1D*)file->Get("cutflow_electrons_2");
@@ -175,6 +176,7 @@ EL::StatusCode ElectronSelector :: initialize ()
       m_el_cutflow_BL_cut    = m_el_cutflowHist_2->GetXaxis()->FindBin("BL_cut");
       m_el_cutflow_PID_cut     = m_el_cutflowHist_2->GetXaxis()->FindBin("PID_cut");
       m_el_cutflow_iso_cut     = m_el_cutflowHist_2->GetXaxis()->FindBin("iso_cut");
+      m_el_cutflowCounter_2.setHistograms( m_el_cutflowHist_2 );
     }
 
   }
@@ -745,6 +747,8 @@ EL::StatusCode ElectronSelector :: finalize ()
     ANA_MSG_INFO( "Filling cutflow");
     m_cutflowHist ->SetBinContent( m_cutflow_bin, m_numEventPass        );
     m_cutflowHistW->SetBinContent( m_cutflow_bin, m_weightNumEventPass  );
+    m_el_cutflowCounter_1.materialize();
+    m_el_cutflowCounter_2.materialize();
   }
 
   return EL::StatusCode::SUCCESS;
@@ -781,8 +785,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
   float eta   = ( electron->caloCluster() ) ? electron->caloCluster()->etaBE(2) : -999.0;
 
   // fill cutflow bin 'all' before any cut
-  if( !m_isUsedBefore && m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_all, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_all, 1 ); }
+  if( !m_isUsedBefore && m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_all );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_all ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -794,8 +798,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_author_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_author_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_author_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_author_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -807,8 +811,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_OQ_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_OQ_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_OQ_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_OQ_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -820,8 +824,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_ptmax_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_ptmax_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_ptmax_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_ptmax_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -833,8 +837,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_ptmin_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_ptmin_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_ptmin_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_ptmin_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -857,8 +861,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_eta_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_eta_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_eta_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_eta_cut ); }
 
 
   // *********************************************************************************************************************************************************************
@@ -891,8 +895,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if ( !m_isUsedBefore && m_useCutFlow ) m_el_cutflowHist_1->Fill( m_el_cutflow_z0sintheta_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_z0sintheta_cut, 1 ); }
+  if ( !m_isUsedBefore && m_useCutFlow ) m_el_cutflowCounter_1.fill( m_el_cutflow_z0sintheta_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_z0sintheta_cut ); }
 
   // decorate electron w/ z0*sin(theta) info
   static SG::AuxElement::Decorator< float > z0sinthetaDecor("z0sintheta");
@@ -906,8 +910,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if ( !m_isUsedBefore && m_useCutFlow ) m_el_cutflowHist_1->Fill( m_el_cutflow_d0_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_d0_cut, 1 ); }
+  if ( !m_isUsedBefore && m_useCutFlow ) m_el_cutflowCounter_1.fill( m_el_cutflow_d0_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_d0_cut ); }
 
   // d0sig cut
   //
@@ -917,8 +921,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if ( !m_isUsedBefore && m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_d0sig_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_d0sig_cut, 1 ); }
+  if ( !m_isUsedBefore && m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_d0sig_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_d0sig_cut ); }
 
   // decorate electron w/ d0sig info
   static SG::AuxElement::Decorator< float > d0SigDecor("d0sig");
@@ -946,8 +950,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
 
-    if ( !m_isUsedBefore && m_useCutFlow ) m_el_cutflowHist_1->Fill( m_el_cutflow_BL_cut, 1 );
-    if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_BL_cut, 1 ); }
+    if ( !m_isUsedBefore && m_useCutFlow ) m_el_cutflowCounter_1.fill( m_el_cutflow_BL_cut );
+    if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_BL_cut ); }
   }
 
   // *********************************************************************************************************************************************************************
@@ -1110,8 +1114,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
     }
   }// if m_doCutBasedPID
 
-  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_PID_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_PID_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_PID_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_PID_cut ); }
 
 
   // *********************************************************************************************************************************************************************
@@ -1141,8 +1145,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
     ANA_MSG_DEBUG( "Electron failed isolation cut " << m_MinIsoWPCut );
     return 0;
   }
-  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_iso_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_iso_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_iso_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_iso_cut ); }
 
   return 1;
 }
@@ -1,6 +1,7 @@
 #include "xAODAnaHelpers/EventInfo.h"
 #include <xAODAnaHelpers/HelperFunctions.h>
 #include <iostream>
+#include <cmath>
 #include "xAODTruth/TruthEventContainer.h"
 #include "xAODEventShape/EventShape.h"
 #include "xAODCaloEvent/CaloClusterContainer.h"
@@ -365,42 +366,41 @@ void EventInfo::FillEvent( const xAOD::EventInfo* eventInfo, xAOD::TEvent* event
   }
 
   if ( m_infoSwitch.m_shapeLC && event ) {
-    const xAOD::EventShape* evtShape(nullptr);
-    HelperFunctions::retrieve( evtShape, "Kt4LCTopoOriginEventShape", event, 0 );
-    if ( !evtShape->getDensity( xAOD::EventShape::Density, m_rhoLC ) ) {
-      Info("FillEvent()","Could not retrieve xAOD::EventShape::Density from xAOD::EventShape");
-      m_rhoLC = -999;
-    }
+    static const std::string shapeLCName("Kt4LCTopoOriginEventShape");
+    m_rhoLC = eventShapeDensity( event, shapeLCName );
   }
 
   if ( m_infoSwitch.m_shapeEM && event ) {
-    const xAOD::EventShape* evtShape(nullptr);
-    HelperFunctions::retrieve( evtShape, "Kt4EMTopoOriginEventShape", event, 0 );
-    if ( !evtShape->getDensity( xAOD::EventShape::Density, m_rhoEM ) ) {
-      Info("FillEvent()","Could not retrieve xAOD::EventShape::Density from xAOD::EventShape");
-      m_rhoEM = -999;
-    }
+    static const std::string shapeEMName("Kt4EMTopoOriginEventShape");
+    m_rhoEM = eventShapeDensity( event, shapeEMName );
   }
 
   if ( m_infoSwitch.m_shapeEMPFLOW && event ) {
-    const xAOD::EventShape* evtShape(nullptr);
-    HelperFunctions::retrieve( evtShape, "Kt4EMPFlowEventShape", event, 0 );
-    if ( !evtShape->getDensity( xAOD::EventShape::Density, m_rhoEMPFLOW ) ) {
-      Info("FillEvent()","Could not retrieve xAOD::EventShape::Density from xAOD::EventShape");
-      m_rhoEMPFLOW = -999;
-    }
+    static const std::string shapeEMPFlowName("Kt4EMPFlowEventShape");
+    m_rhoEMPFLOW = eventShapeDensity( event, shapeEMPFlowName );
   }
 
   if( m_infoSwitch.m_caloClus && event ) {
+    static const std::string caloClustersName("CaloCalTopoClusters");
     const xAOD::CaloClusterContainer* caloClusters = 0;
-    HelperFunctions::retrieve( caloClusters, "CaloCalTopoClusters", event, 0);
-    // save the clusters at the EM scale
-    for( auto clus : * caloClusters ) {
-      if ( clus->pt ( xAOD::CaloCluster::State::UNCALIBRATED ) < 2000 ) { continue; } // 2 GeV cut
-      m_caloCluster_pt. push_back( clus->pt ( xAOD::CaloCluster::State::UNCALIBRATED ) / m_units );
-      m_caloCluster_eta.push_back( clus->eta( xAOD::CaloCluster::State::UNCALIBRATED ) );
-      m_caloCluster_phi.push_back( clus->phi( xAOD::CaloCluster::State::UNCALIBRATED ) );
-      m_caloCluster_e.  push_back( clus->e  ( xAOD::CaloCluster::State::UNCALIBRATED ) / m_units );
+    if ( event->retrieve( caloClusters, caloClustersName ).isSuccess() ) {
+      m_caloCluster_pt. reserve( caloClusters->size() );
+      m_caloCluster_eta.reserve( caloClusters->size() );
+      m_caloCluster_phi.reserve( caloClusters->size() );
+      m_caloCluster_e.  reserve( caloClusters->size() );
+      // save the clusters at the EM scale, reading each raw (uncalibrated) quantity once
+      for( auto clus : * caloClusters ) {
+        const float e   = clus->rawE();
+        const float eta = clus->rawEta();
+        const float pt  = e / std::cosh( eta );
+        if ( pt < 2000 ) { continue; } // 2 GeV cut
+        m_caloCluster_pt. push_back( pt / m_units );
+        m_caloCluster_eta.push_back( eta );
+        m_caloCluster_phi.push_back( clus->rawPhi() );
+        m_caloCluster_e.  push_back( e / m_units );
+      }
+    } else {
+      Info("FillEvent()","Could not retrieve %s", caloClustersName.c_str());
     }
   }
 
@@ -429,3 +429,14 @@ void EventInfo::FillEvent( const xAOD::EventInfo* eventInfo, xAOD::TEvent* event
 
   return;
 }
+
+double EventInfo::eventShapeDensity( xAOD::TEvent* event, const std::string& name ) const
+{
+  const xAOD::EventShape* evtShape(nullptr);
+  double rho(-999);
+  if ( !event->retrieve( evtShape, name ).isSuccess() || !evtShape->getDensity( xAOD::EventShape::Density, rho ) ) {
+    Info("FillEvent()","Could not retrieve xAOD::EventShape::Density from %s", name.c_str());
+    return -999;
+  }
+  return rho;
+}
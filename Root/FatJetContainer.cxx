@@ -168,6 +168,7 @@ void FatJetContainer::setTree(TTree *tree)
   //
   // Connect branches
   ParticleContainer::setTree(tree);
+  if ( m_lazy ) return;
 
   if( m_infoSwitch.m_scales ) {
     connectBranch<float>(tree, "JetConstitScaleMomentum_eta", &m_JetConstitScaleMomentum_eta);
@@ -398,6 +399,14 @@ void FatJetContainer::setBranches(TTree *tree)
   return;
 }
 
+void FatJetContainer::quantizeBranches()
+{
+  ParticleContainer::quantizeBranches();
+
+  for(const auto& kv : m_trkJets)
+    kv.second->quantizeBranches();
+}
+
 
 void FatJetContainer::clear()
 {
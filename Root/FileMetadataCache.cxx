@@ -0,0 +1,267 @@
+/******************************************
+ *
+ * On-disk cache of the per-file CutBookkeeper
+ * sums used by BasicEventSelection.
+ *
+ ******************************************/
+
+#include <AsgTools/MessageCheck.h>
+
+#include "xAODAnaHelpers/FileMetadataCache.h"
+
+// EDM include(s):
+#include "xAODRootAccess/TEvent.h"
+#include "xAODCutFlow/CutBookkeeper.h"
+#include "xAODCutFlow/CutBookkeeperContainer.h"
+
+// ROOT include(s):
+#include <TFile.h>
+#include <TSystem.h>
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+FileMetadataCache::FileMetadataCache() :
+  m_modified(false),
+  m_msg("FileMetadataCache")
+{
+  m_msg.setLevel(MSG::INFO);
+}
+
+bool FileMetadataCache::read(const std::string& fileName) {
+  std::ifstream in(fileName);
+  if( !in ) return false;
+
+  std::string line;
+  while( std::getline(in, line) ) {
+    if( line.empty() || line[0] == '#' ) continue;
+
+    std::vector<std::string> fields;
+    std::istringstream lineStream(line);
+    std::string field;
+    while( std::getline(lineStream, field, '\t') ) fields.push_back(field);
+    // a trailing empty field is not returned by getline
+    if( line.back() == '\t' ) fields.push_back("");
+
+    // every numerical field has to be there and parse completely
+    bool good( fields.size() == 12 );
+    auto parse = [&](size_t index, auto& value) {
+      if( !good ) return;
+      std::istringstream valueStream(fields[index]);
+      good = static_cast<bool>(valueStream >> value) && valueStream.eof();
+    };
+
+    Entry entry;
+    parse(2,  entry.size);
+    parse(3,  entry.modTime);
+    parse(4,  entry.summary.isDerivation);
+    parse(6,  entry.summary.initialNevents);
+    parse(7,  entry.summary.finalNevents);
+    parse(8,  entry.summary.initialSumW);
+    parse(9,  entry.summary.finalSumW);
+    parse(10, entry.summary.initialSumWSquared);
+    parse(11, entry.summary.finalSumWSquared);
+    if( !good ) {
+      ANA_MSG_WARNING( "Skipping malformed line in " << fileName << ": " << line );
+      continue;
+    }
+    entry.summary.derivationAlg = fields[5];
+
+    const std::string& file           = fields[0];
+    const std::string& derivationName = fields[1];
+    m_entries[std::make_pair(file, derivationName)] = entry;
+  }
+
+  return true;
+}
+
+bool FileMetadataCache::write(const std::string& fileName) const {
+  std::string tmpName = fileName + ".tmp" + std::to_string(gSystem->GetPid());
+  {
+    std::ofstream out(tmpName);
+    if( !out ) return false;
+
+    out.precision(std::numeric_limits<double>::max_digits10);
+    out << "# file\tderivationName\tsize\tmodTime\tisDerivation\tderivationAlg\tinitialNevents\tfinalNevents\tinitialSumW\tfinalSumW\tinitialSumWSquared\tfinalSumWSquared\n";
+    for( const auto& entry : m_entries ) {
+      const Summary& summary = entry.second.summary;
+      out << entry.first.first << '\t' << entry.first.second << '\t'
+          << entry.second.size << '\t' << entry.second.modTime << '\t'
+          << summary.isDerivation << '\t' << summary.derivationAlg << '\t'
+          << summary.initialNevents << '\t' << summary.finalNevents << '\t'
+          << summary.initialSumW << '\t' << summary.finalSumW << '\t'
+          << summary.initialSumWSquared << '\t' << summary.finalSumWSquared << '\n';
+    }
+    if( !out ) return false;
+  }
+
+  return std::rename(tmpName.c_str(), fileName.c_str()) == 0;
+}
+
+void FileMetadataCache::merge(const FileMetadataCache& other) {
+  for( const auto& entry : other.m_entries ) m_entries[entry.first] = entry.second;
+  if( !other.m_entries.empty() ) m_modified = true;
+}
+
+bool FileMetadataCache::find(const std::string& fileName, const std::string& derivationName, Summary& summary) const {
+  auto found = m_entries.find(std::make_pair(fileName, derivationName));
+  if( found == m_entries.end() ) return false;
+
+  Long64_t size;
+  Long_t   modTime;
+  if( !fileStat(fileName, size, modTime) || size != found->second.size || modTime != found->second.modTime ) return false;
+
+  summary = found->second.summary;
+  return true;
+}
+
+void FileMetadataCache::add(const std::string& fileName, const std::string& derivationName, const Summary& summary) {
+  Entry entry;
+  if( !fileStat(fileName, entry.size, entry.modTime) ) return;
+  entry.summary = summary;
+  m_entries[std::make_pair(fileName, derivationName)] = entry;
+  m_modified = true;
+}
+
+StatusCode FileMetadataCache::summarize(xAOD::TEvent* event, TTree* MetaData, const std::string& derivationName, Summary& summary) {
+
+  //check if file is from a DxAOD
+  summary = Summary();
+  summary.isDerivation = !MetaData->GetBranch("StreamAOD");
+
+  // Check for potential file corruption
+  //
+  // If there are some Incomplete CBK, throw a WARNING,
+  // unless ALL of them have inputStream == "unknownStream"
+  //
+  const xAOD::CutBookkeeperContainer* incompleteCBC(nullptr);
+  if ( !event->retrieveMetaInput(incompleteCBC, "IncompleteCutBookkeepers").isSuccess() ) {
+    ANA_MSG_ERROR("Failed to retrieve IncompleteCutBookkeepers from MetaData! Exiting.");
+    return StatusCode::FAILURE;
+  }
+  bool allFromUnknownStream(true);
+  if ( incompleteCBC->size() != 0 ) {
+
+    std::string stream("");
+    for ( auto cbk : *incompleteCBC ) {
+      ANA_MSG_INFO("Incomplete cbk name: " << cbk->name() << " - stream: " << cbk->inputStream());
+      if ( cbk->inputStream() != "unknownStream" ) {
+        allFromUnknownStream = false;
+        stream = cbk->inputStream();
+        break;
+      }
+    }
+    if ( !allFromUnknownStream ) { ANA_MSG_WARNING("Found incomplete CBK from stream: " << stream << ". This is not necessarily a sign of file corruption (incomplete CBK appear when 'maxevents' is set in the AOD jo, for instance), but you may still want to check input file for potential corruption..." ); }
+
+  }
+
+  // Now, let's find the actual information
+  //
+  const xAOD::CutBookkeeperContainer* completeCBC(nullptr);
+  if ( !event->retrieveMetaInput(completeCBC, "CutBookkeepers").isSuccess() ) {
+    ANA_MSG_ERROR("Failed to retrieve CutBookkeepers from MetaData! Exiting.");
+    return StatusCode::FAILURE;
+  }
+
+  // Now, let's actually find the right one that contains all the needed info...
+  const xAOD::CutBookkeeper* allEventsCBK(nullptr);
+  const xAOD::CutBookkeeper* DxAODEventsCBK(nullptr);
+
+  if ( summary.isDerivation ) {
+    if(derivationName != ""){
+      ANA_MSG_INFO("Override auto config to look at DAOD made by Derivation Algorithm: " << derivationName);
+    }else{
+      ANA_MSG_INFO("Will autoconfig to look at DAOD made by Derivation Algorithm.");
+    }
+  }
+
+  int maxCycle(-1);
+  for ( const auto& cbk: *completeCBC ) {
+    ANA_MSG_INFO("Complete cbk name: " << cbk->name() << " - stream: " << cbk->inputStream() );
+    if ( cbk->cycle() > maxCycle && cbk->name() == "AllExecutedEvents" && cbk->inputStream() == "StreamAOD" ) {
+      allEventsCBK = cbk;
+      maxCycle = cbk->cycle();
+    }
+    if ( summary.isDerivation ) {
+
+      if(derivationName != ""){
+
+        if ( cbk->name() == derivationName ) {
+          DxAODEventsCBK = cbk;
+        }
+
+      } else if( cbk->name().find("Kernel") != std::string::npos ){
+        ANA_MSG_INFO("Auto config found DAOD made by Derivation Algorithm: " << cbk->name());
+        DxAODEventsCBK = cbk;
+      }
+
+    } // is derivation
+  }
+
+  if(allEventsCBK == nullptr) {
+    ANA_MSG_WARNING("No allEventsCBK found (this is expected for DataScouting, otherwise not). Event numbers set to 0.");
+  }
+  else {
+    summary.initialNevents     = allEventsCBK->nAcceptedEvents();
+    summary.initialSumW        = allEventsCBK->sumOfEventWeights();
+    summary.initialSumWSquared = allEventsCBK->sumOfEventWeightsSquared();
+  }
+
+  if ( summary.isDerivation && !DxAODEventsCBK ) {
+    ANA_MSG_ERROR( "No CutBookkeeper corresponds to the selected Derivation Framework algorithm name. Check it with your DF experts! Aborting.");
+    return StatusCode::FAILURE;
+  }
+
+  summary.derivationAlg      = ( summary.isDerivation ) ? DxAODEventsCBK->name() : "";
+  summary.finalNevents       = ( summary.isDerivation ) ? DxAODEventsCBK->nAcceptedEvents() : summary.initialNevents;
+  summary.finalSumW          = ( summary.isDerivation ) ? DxAODEventsCBK->sumOfEventWeights() : summary.initialSumW;
+  summary.finalSumWSquared   = ( summary.isDerivation ) ? DxAODEventsCBK->sumOfEventWeightsSquared() : summary.initialSumWSquared;
+
+  return StatusCode::SUCCESS;
+}
+
+StatusCode FileMetadataCache::summarizeFile(const std::string& fileName, const std::string& derivationName) {
+  std::unique_ptr<TFile> file(TFile::Open(fileName.c_str(), "READ"));
+  if ( !file || file->IsZombie() ) {
+    ANA_MSG_ERROR( "Cannot open " << fileName );
+    return StatusCode::FAILURE;
+  }
+
+  TTree* MetaData = dynamic_cast<TTree*>( file->Get("MetaData") );
+  if ( !MetaData ) {
+    ANA_MSG_ERROR( "MetaData tree not found in " << fileName );
+    return StatusCode::FAILURE;
+  }
+  MetaData->LoadTree(0);
+
+  xAOD::TEvent event(xAOD::TEvent::kClassAccess);
+  ANA_CHECK( event.readFrom(file.get()) );
+
+  Summary summary;
+  ANA_CHECK( summarize(&event, MetaData, derivationName, summary) );
+  add(fileName, derivationName, summary);
+
+  return StatusCode::SUCCESS;
+}
+
+bool FileMetadataCache::fileStat(const std::string& fileName, Long64_t& size, Long_t& modTime) {
+  FileStat_t stat;
+  if( gSystem->GetPathInfo(fileName.c_str(), stat) != 0 ) return false;
+  size    = stat.fSize;
+  modTime = stat.fMtime;
+  return true;
+}
+
+MsgStream& FileMetadataCache :: msg () const {
+  return m_msg;
+}
+
+MsgStream& FileMetadataCache :: msg (int level) const {
+  MsgStream& result = msg();
+  result << MSG::Level (level);
+  return result;
+}
@@ -1,5 +1,7 @@
 // c++ include(s):
 #include <iostream>
+#include <typeinfo>
+#include <algorithm>
 
 // EDM include(s):
 #include "xAODBTagging/BTagging.h"
@@ -20,6 +22,9 @@
 
 #include "AsgTools/StatusCode.h"
 
+// ROOT include(s):
+#include "TObjString.h"
+
 using std::vector;
 
 // needed? should it be here?
@@ -31,6 +36,8 @@ HelpTreeBase::HelpTreeBase(xAOD::TEvent* event, TTree* tree, TFile* file, const
   m_trigInfoSwitch(nullptr),
   m_trigConfTool(nullptr),
   m_trigDecTool(nullptr),
+  m_userHooks(true),
+  m_perObjectUserHooks(true),
   m_eventInfo(nullptr)
 {
 
@@ -41,6 +48,10 @@ HelpTreeBase::HelpTreeBase(xAOD::TEvent* event, TTree* tree, TFile* file, const
   m_nominalTree = strcmp(m_tree->GetName(), "nominal") == 0;
   m_event = event;
   m_store = store;
+  m_trigChainList = nullptr;
+  m_trkSelEventKnown = false;
+  m_trkSelRunNumber = 0;
+  m_trkSelEventNumber = 0;
   Info("HelpTreeBase()", "HelpTreeBase setup");
 
   // turn things off it this is data...since TStore is not a needed input
@@ -114,8 +125,31 @@ HelpTreeBase::HelpTreeBase(TTree* tree, TFile* file, xAOD::TEvent* event, xAOD::
 }
 
 
+void HelpTreeBase::setUserHooks() {
+  // virtual calls do not reach the subclass in the constructor, so this is done when the branches are added
+  m_userHooks = ( typeid(*this) != typeid(HelpTreeBase) );
+  m_perObjectUserHooks = m_userHooks && this->wantsPerObjectHooks();
+}
+
 void HelpTreeBase::Fill() {
+  // containers with reduced precision branches round them before they are written
+  quantizeBranches(m_jets);
+  quantizeBranches(m_truth);
+  quantizeBranches(m_tracks);
+  quantizeBranches(m_fatjets);
+  quantizeBranches(m_truth_fatjets);
+  quantizeBranches(m_muons);
+  quantizeBranches(m_elecs);
+  quantizeBranches(m_photons);
+  quantizeBranches(m_clusters);
+  quantizeBranches(m_taus);
+
+  // flat truth links of particles filled one by one are only resolved once the whole event is filled
+  for ( const auto& truth : m_truth ) truth.second->FillTruthLinks();
+
   m_tree->Fill();
+
+  m_trkSelEventKnown = false;
 }
 
 /*********************
@@ -124,7 +158,7 @@ void HelpTreeBase::Fill() {
  *
  ********************/
 
-void HelpTreeBase::AddEvent( const std::string detailStr ) {
+void HelpTreeBase::AddEvent( const std::string& detailStr ) {
 
   if(m_debug)  Info("AddEvent()", "Adding event variables: %s", detailStr.c_str());
 
@@ -144,6 +178,10 @@ void HelpTreeBase::FillEvent( const xAOD::EventInfo* eventInfo, xAOD::TEvent* /*
 
   m_eventInfo->FillEvent(eventInfo, m_event, vertices);
 
+  m_trkSelEventKnown  = true;
+  m_trkSelRunNumber   = eventInfo->runNumber();
+  m_trkSelEventNumber = eventInfo->eventNumber();
+
   this->FillEventUser(eventInfo);
 }
 
@@ -152,7 +190,7 @@ void HelpTreeBase::FillEvent( const xAOD::EventInfo* eventInfo, xAOD::TEvent* /*
  *   TRIGGER
  *
  ********************/
-void HelpTreeBase::AddTrigger( const std::string detailStr ) {
+void HelpTreeBase::AddTrigger( const std::string& detailStr ) {
 
   if(m_debug) Info("AddTrigger()", "Adding trigger variables: %s", detailStr.c_str());
 
@@ -192,6 +230,18 @@ void HelpTreeBase::AddTrigger( const std::string detailStr ) {
     m_tree->Branch("isPassBitsNames",      &m_isPassBitsNames     );
   }
 
+  if ( m_trigInfoSwitch->m_passTrigMask ) {
+    m_tree->Branch("passedTriggersMask",   &m_passedTriggersMask  );
+    m_tree->Branch("disabledTriggersMask", &m_disabledTriggersMask);
+    // chain names in id order, in their own list as other objects are stored in the UserInfo too
+    m_trigChainList = new TList();
+    m_trigChainList->SetName("passTrigMaskChains");
+    m_tree->GetUserInfo()->Add( m_trigChainList );
+    if ( !m_isMC && m_trigInfoSwitch->m_prescales ) {
+      m_tree->Branch("triggerPrescalesById", &m_triggerPrescalesById);
+    }
+  }
+
   //this->AddTriggerUser();
 }
 
@@ -276,6 +326,59 @@ void HelpTreeBase::FillTrigger( const xAOD::EventInfo* eventInfo ) {
 
   }
 
+  // Same content as passTriggers, but as bits indexed by chain id. The decorations
+  // are only read by reference, only the passed/disabled chains are looked up.
+  if ( m_trigInfoSwitch->m_passTrigMask ) {
+
+    if ( m_debug ) { Info("HelpTreeBase::FillTrigger()", "Switch: m_trigInfoSwitch->m_passTrigMask"); }
+
+    // seed the dictionary with the full list of configured chains, so the ids follow the configuration order
+    static SG::AuxElement::ConstAccessor< std::vector< std::string > > acc_chainNames("isPassedBitsNames");
+    if ( m_trigChainNames.empty() && acc_chainNames.isAvailable( *eventInfo ) ) {
+      for ( const std::string& chainName : acc_chainNames( *eventInfo ) ) { this->trigChainId( chainName ); }
+    }
+
+    static SG::AuxElement::ConstAccessor< std::vector< std::string > > acc_passedTriggers  ("passedTriggers");
+    static SG::AuxElement::ConstAccessor< std::vector< std::string > > acc_disabledTriggers("disabledTriggers");
+    static SG::AuxElement::ConstAccessor< std::vector< float > >       acc_trigPrescales   ("triggerPrescales");
+
+    if ( acc_passedTriggers.isAvailable( *eventInfo ) ) {
+      const std::vector< std::string >& passedTriggers = acc_passedTriggers( *eventInfo );
+      const std::vector< float >* prescales = ( !m_isMC && m_trigInfoSwitch->m_prescales && acc_trigPrescales.isAvailable( *eventInfo ) ) ? &acc_trigPrescales( *eventInfo ) : nullptr;
+      for ( unsigned int i = 0; i < passedTriggers.size(); ++i ) {
+        unsigned int id = this->trigChainId( passedTriggers[i] );
+        m_passedTriggersMask[ id / 64 ] |= ( 1ULL << ( id % 64 ) );
+        if ( prescales && i < prescales->size() ) { m_triggerPrescalesById[ id ] = prescales->at(i); }
+      }
+    }
+
+    if ( acc_disabledTriggers.isAvailable( *eventInfo ) ) {
+      for ( const std::string& chainName : acc_disabledTriggers( *eventInfo ) ) {
+        unsigned int id = this->trigChainId( chainName );
+        m_disabledTriggersMask[ id / 64 ] |= ( 1ULL << ( id % 64 ) );
+      }
+    }
+
+  }
+
+}
+
+unsigned int HelpTreeBase::trigChainId( const std::string& chainName ) {
+
+  auto it = m_trigChainIds.find( chainName );
+  if ( it != m_trigChainIds.end() ) { return it->second; }
+
+  // new chain: give it the next id, and record the name once in the tree metadata
+  unsigned int id = m_trigChainNames.size();
+  m_trigChainIds[ chainName ] = id;
+  m_trigChainNames.push_back( chainName );
+  if ( m_trigChainList ) m_trigChainList->Add( new TObjString( chainName.c_str() ) );
+
+  m_passedTriggersMask  .resize( m_trigChainNames.size() / 64 + 1, 0 );
+  m_disabledTriggersMask.resize( m_trigChainNames.size() / 64 + 1, 0 );
+  m_triggerPrescalesById.resize( m_trigChainNames.size(), -1 );
+
+  return id;
 }
 
 // Clear Trigger
@@ -295,6 +398,11 @@ void HelpTreeBase::ClearTrigger() {
   m_isPassBits.clear();
   m_isPassBitsNames.clear();
 
+  // the masks keep their width, only the bits are reset
+  std::fill( m_passedTriggersMask  .begin(), m_passedTriggersMask  .end(),  0 );
+  std::fill( m_disabledTriggersMask.begin(), m_disabledTriggersMask.end(),  0 );
+  std::fill( m_triggerPrescalesById.begin(), m_triggerPrescalesById.end(), -1 );
+
 }
 
 /*********************
@@ -305,7 +413,7 @@ void HelpTreeBase::ClearTrigger() {
 
 /* TODO: jet trigger */
 //CD: is this useful at all?
-void HelpTreeBase::AddJetTrigger( const std::string detailStr )
+void HelpTreeBase::AddJetTrigger( const std::string& detailStr )
 {
   if ( m_debug )  Info("AddJetTrigger()", "Adding jet trigger variables: %s", detailStr.c_str());
 }
@@ -319,17 +427,16 @@ void HelpTreeBase::ClearJetTrigger(  ) { }
  *
  ********************/
 
-void HelpTreeBase::AddMuons(const std::string detailStr, const std::string muonName) {
+xAH::MuonContainer* HelpTreeBase::AddMuons(const std::string& detailStr, const std::string& muonName) {
 
   if ( m_debug )  Info("AddMuons()", "Adding muon variables: %s", detailStr.c_str());
 
-  m_muons[muonName] = new xAH::MuonContainer(muonName, detailStr, m_units, m_isMC, m_nominalTree);
-  xAH::MuonContainer* thisMuon = m_muons[muonName];
+  xAH::MuonContainer* thisMuon = new xAH::MuonContainer(muonName, detailStr, m_units, m_isMC, m_nominalTree);
+  m_muons[muonName] = thisMuon;
   HelperClasses::MuonInfoSwitch& muonInfoSwitch = thisMuon->m_infoSwitch;
 
-  std::string tname = m_tree->GetName();
-
-  if ( tname == "nominal" ) {
+  // with effSFFlat the systematic names are written once, in the tree UserInfo
+  if ( m_nominalTree && !muonInfoSwitch.m_effSFFlat ) {
 
      if ( muonInfoSwitch.m_recoEff_sysNames && muonInfoSwitch.m_effSF && m_isMC ) {
        for (auto& reco : muonInfoSwitch.m_recoWPs) {
@@ -360,17 +467,41 @@ void HelpTreeBase::AddMuons(const std::string detailStr, const std::string muonN
   }
 
   thisMuon->setBranches(m_tree);
+  this->setUserHooks();
   this->AddMuonsUser(detailStr, muonName);
+
+  return thisMuon;
+}
+
+void HelpTreeBase::FillMuons( const xAOD::MuonContainer* muons, const xAOD::Vertex* primaryVertex, const std::string& muonName ) {
+  this->FillMuons(m_muons[muonName], muons, primaryVertex);
 }
 
-void HelpTreeBase::FillMuons( const xAOD::MuonContainer* muons, const xAOD::Vertex* primaryVertex, const std::string muonName ) {
+void HelpTreeBase::FillMuons( xAH::MuonContainer* thisMuon, const xAOD::MuonContainer* muons, const xAOD::Vertex* primaryVertex ) {
+
+  this->ClearMuons(thisMuon);
+  HelperClasses::MuonInfoSwitch& muonInfoSwitch = thisMuon->m_infoSwitch;
+
+  // with effSFFlat the systematic names are written once, in the tree UserInfo
+  if ( m_nominalTree && muonInfoSwitch.m_effSFFlat && muonInfoSwitch.m_effSF && m_isMC ) {
 
-  this->ClearMuons(muonName);
-  HelperClasses::MuonInfoSwitch& muonInfoSwitch = m_muons[muonName]->m_infoSwitch;
+    for ( auto& reco : muonInfoSwitch.m_recoWPs ) {
+      this->setFlatSFSysNames(thisMuon, "RecoEff_SF_Reco" + reco, "MuonEfficiencyCorrector_RecoSyst_Reco" + reco);
 
-  std::string tname = m_tree->GetName();
+      for ( auto& trig : muonInfoSwitch.m_trigWPs ) {
+        this->setFlatSFSysNames(thisMuon, "TrigEff_SF_" + trig + "_Reco" + reco, "MuonEfficiencyCorrector_TrigSyst_" + trig + "_Reco" + reco);
+        this->setFlatSFSysNames(thisMuon, "TrigMCEff_"  + trig + "_Reco" + reco, "MuonEfficiencyCorrector_TrigSyst_" + trig + "_Reco" + reco);
+      }
+    }
 
-  if ( tname == "nominal" ) {
+    for ( auto& isol : muonInfoSwitch.m_isolWPs ) {
+      this->setFlatSFSysNames(thisMuon, "IsoEff_SF_Iso" + isol, "MuonEfficiencyCorrector_IsoSyst_Iso" + isol);
+    }
+
+    this->setFlatSFSysNames(thisMuon, "TTVAEff_SF", "MuonEfficiencyCorrector_TTVASyst_TTVA");
+
+  }
+  else if ( m_nominalTree ) {
 
     if ( muonInfoSwitch.m_recoEff_sysNames && muonInfoSwitch.m_effSF && m_isMC ) {
       for ( auto& reco : muonInfoSwitch.m_recoWPs ) {
@@ -409,29 +540,36 @@ void HelpTreeBase::FillMuons( const xAOD::MuonContainer* muons, const xAOD::Vert
   }
 
   for( auto muon_itr : *muons ) {
-    this->FillMuon(muon_itr, primaryVertex, muonName);
+    thisMuon->FillMuon(muon_itr, primaryVertex);
+    if ( m_perObjectUserHooks ) this->FillMuonsUser(muon_itr, thisMuon->name());
   }
 
+  if ( m_userHooks ) this->FillMuonCollectionUser(muons, thisMuon);
+
 }
 
-void HelpTreeBase::FillMuon( const xAOD::Muon* muon, const xAOD::Vertex* primaryVertex, const std::string muonName ) {
+void HelpTreeBase::FillMuon( const xAOD::Muon* muon, const xAOD::Vertex* primaryVertex, const std::string& muonName ) {
+  this->FillMuon(m_muons[muonName], muon, primaryVertex);
+}
 
-  xAH::MuonContainer* thisMuon = m_muons[muonName];
+void HelpTreeBase::FillMuon( xAH::MuonContainer* thisMuon, const xAOD::Muon* muon, const xAOD::Vertex* primaryVertex ) {
 
   thisMuon->FillMuon(muon, primaryVertex);
 
-  this->FillMuonsUser(muon, muonName);
+  if ( m_perObjectUserHooks ) this->FillMuonsUser(muon, thisMuon->name());
 
   return;
 }
 
-void HelpTreeBase::ClearMuons(const std::string muonName) {
+void HelpTreeBase::ClearMuons(const std::string& muonName) {
+  this->ClearMuons(m_muons[muonName]);
+}
+
+void HelpTreeBase::ClearMuons(xAH::MuonContainer* thisMuon) {
 
-  std::string tname = m_tree->GetName();
-  xAH::MuonContainer* thisMuon = m_muons[muonName];
   HelperClasses::MuonInfoSwitch& muonInfoSwitch = thisMuon->m_infoSwitch;
 
-  if ( tname == "nominal" ) {
+  if ( m_nominalTree ) {
 
     if ( muonInfoSwitch.m_recoEff_sysNames && muonInfoSwitch.m_effSF && m_isMC ) {
       for ( auto& reco : muonInfoSwitch.m_recoWPs ) {
@@ -459,7 +597,7 @@ void HelpTreeBase::ClearMuons(const std::string muonName) {
 
   thisMuon->clear();
 
-  this->ClearMuonsUser(muonName);
+  this->ClearMuonsUser(thisMuon->name());
 
 }
 
@@ -469,46 +607,82 @@ void HelpTreeBase::ClearMuons(const std::string muonName) {
  *
  ********************/
 
-void HelpTreeBase::AddElectrons(const std::string detailStr, const std::string elecName) {
+xAH::ElectronContainer* HelpTreeBase::AddElectrons(const std::string& detailStr, const std::string& elecName) {
 
   if(m_debug)  Info("AddElectrons()", "Adding electron variables: %s", detailStr.c_str());
 
-  m_elecs[elecName] = new xAH::ElectronContainer(elecName, detailStr, m_units, m_isMC, m_nominalTree);
-
-  xAH::ElectronContainer* thisElec = m_elecs[elecName];
+  xAH::ElectronContainer* thisElec = new xAH::ElectronContainer(elecName, detailStr, m_units, m_isMC, m_nominalTree);
+  m_elecs[elecName] = thisElec;
 
   thisElec->setBranches(m_tree);
+  this->setUserHooks();
   this->AddElectronsUser(detailStr, elecName);
+
+  return thisElec;
+}
+
+
+void HelpTreeBase::FillElectrons( const xAOD::ElectronContainer* electrons, const xAOD::Vertex* primaryVertex, const std::string& elecName ) {
+  this->FillElectrons(m_elecs[elecName], electrons, primaryVertex);
 }
 
+void HelpTreeBase::FillElectrons( xAH::ElectronContainer* thisElec, const xAOD::ElectronContainer* electrons, const xAOD::Vertex* primaryVertex ) {
 
-void HelpTreeBase::FillElectrons( const xAOD::ElectronContainer* electrons, const xAOD::Vertex* primaryVertex, const std::string elecName ) {
+  this->ClearElectrons(thisElec);
+  HelperClasses::ElectronInfoSwitch& elecInfoSwitch = thisElec->m_infoSwitch;
 
-  this->ClearElectrons(elecName);
+  // with effSFFlat the systematic names are written once, in the tree UserInfo
+  if ( m_nominalTree && elecInfoSwitch.m_effSFFlat && elecInfoSwitch.m_effSF && m_isMC ) {
+
+    for ( auto& PID : elecInfoSwitch.m_PIDSFWPs ) {
+      this->setFlatSFSysNames(thisElec, "PIDEff_SF_" + PID, "EleEffCorr_PIDSyst_" + PID);
+
+      for ( auto& isol : elecInfoSwitch.m_isolWPs ) {
+        std::string isolSuffix = !isol.empty() ? "_isol" + isol : "";
+        if ( !isol.empty() )
+          this->setFlatSFSysNames(thisElec, "IsoEff_SF_" + PID + isolSuffix, "EleEffCorr_IsoSyst_" + PID + isolSuffix);
+        for ( auto& trig : elecInfoSwitch.m_trigWPs ) {
+          this->setFlatSFSysNames(thisElec, "TrigEff_SF_" + trig + "_" + PID + isolSuffix, "EleEffCorr_TrigSyst_" + trig + "_" + PID + isolSuffix);
+          this->setFlatSFSysNames(thisElec, "TrigMCEff_"  + trig + "_" + PID + isolSuffix, "EleEffCorr_TrigSyst_" + trig + "_" + PID + isolSuffix);
+        }
+      }
+    }
+
+    this->setFlatSFSysNames(thisElec, "RecoEff_SF", "EleEffCorr_RecoSyst_Reconstruction");
+
+  }
 
   for ( auto el_itr : *electrons ) {
-    this->FillElectron(el_itr, primaryVertex, elecName);
+    thisElec->FillElectron(el_itr, primaryVertex);
+    if ( m_perObjectUserHooks ) this->FillElectronsUser(el_itr, thisElec->name());
   }
+
+  if ( m_userHooks ) this->FillElectronCollectionUser(electrons, thisElec);
 }
 
-void HelpTreeBase::FillElectron ( const xAOD::Electron* elec, const xAOD::Vertex* primaryVertex, const std::string elecName ) {
+void HelpTreeBase::FillElectron ( const xAOD::Electron* elec, const xAOD::Vertex* primaryVertex, const std::string& elecName ) {
+  this->FillElectron(m_elecs[elecName], elec, primaryVertex);
+}
 
-  xAH::ElectronContainer* thisElec = m_elecs[elecName];
+void HelpTreeBase::FillElectron ( xAH::ElectronContainer* thisElec, const xAOD::Electron* elec, const xAOD::Vertex* primaryVertex ) {
 
   thisElec->FillElectron(elec, primaryVertex);
 
-  this->FillElectronsUser(elec, elecName);
+  if ( m_perObjectUserHooks ) this->FillElectronsUser(elec, thisElec->name());
 
   return;
 }
 
 
-void HelpTreeBase::ClearElectrons(const std::string elecName) {
+void HelpTreeBase::ClearElectrons(const std::string& elecName) {
+  this->ClearElectrons(m_elecs[elecName]);
+}
+
+void HelpTreeBase::ClearElectrons(xAH::ElectronContainer* thisElec) {
 
-  xAH::ElectronContainer* thisElec = m_elecs[elecName];
   thisElec->clear();
 
-  this->ClearElectronsUser(elecName);
+  this->ClearElectronsUser(thisElec->name());
 }
 
 /*********************
@@ -517,46 +691,60 @@ void HelpTreeBase::ClearElectrons(const std::string elecName) {
  *
  ********************/
 
-void HelpTreeBase::AddPhotons(const std::string detailStr, const std::string photonName) {
+xAH::PhotonContainer* HelpTreeBase::AddPhotons(const std::string& detailStr, const std::string& photonName) {
 
   if(m_debug)  Info("AddPhotons()", "Adding photon variables: %s", detailStr.c_str());
 
-  m_photons[photonName] = new xAH::PhotonContainer(photonName, detailStr, m_units, m_isMC);
-
-  xAH::PhotonContainer* thisPhoton = m_photons[photonName];
+  xAH::PhotonContainer* thisPhoton = new xAH::PhotonContainer(photonName, detailStr, m_units, m_isMC);
+  m_photons[photonName] = thisPhoton;
 
   thisPhoton->setBranches(m_tree);
+  this->setUserHooks();
   this->AddPhotonsUser(detailStr, photonName);
+
+  return thisPhoton;
 }
 
 
-void HelpTreeBase::FillPhotons( const xAOD::PhotonContainer* photons, const std::string photonName ) {
+void HelpTreeBase::FillPhotons( const xAOD::PhotonContainer* photons, const std::string& photonName ) {
+  this->FillPhotons(m_photons[photonName], photons);
+}
+
+void HelpTreeBase::FillPhotons( xAH::PhotonContainer* thisPhoton, const xAOD::PhotonContainer* photons ) {
 
-  this->ClearPhotons(photonName);
+  this->ClearPhotons(thisPhoton);
 
   for ( auto ph_itr : *photons ) {
-    this->FillPhoton(ph_itr, photonName);
+    thisPhoton->FillPhoton(ph_itr);
+    if ( m_perObjectUserHooks ) this->FillPhotonsUser(ph_itr, thisPhoton->name());
   }
+
+  if ( m_userHooks ) this->FillPhotonCollectionUser(photons, thisPhoton);
 }
 
-void HelpTreeBase::FillPhoton( const xAOD::Photon* photon, const std::string photonName ) {
+void HelpTreeBase::FillPhoton( const xAOD::Photon* photon, const std::string& photonName ) {
+  this->FillPhoton(m_photons[photonName], photon);
+}
 
-  xAH::PhotonContainer* thisPhoton = m_photons[photonName];
+void HelpTreeBase::FillPhoton( xAH::PhotonContainer* thisPhoton, const xAOD::Photon* photon ) {
 
   thisPhoton->FillPhoton(photon);
 
-  this->FillPhotonsUser(photon, photonName);
+  if ( m_perObjectUserHooks ) this->FillPhotonsUser(photon, thisPhoton->name());
 
   return;
 }
 
 
-void HelpTreeBase::ClearPhotons(const std::string photonName) {
+void HelpTreeBase::ClearPhotons(const std::string& photonName) {
+  this->ClearPhotons(m_photons[photonName]);
+}
+
+void HelpTreeBase::ClearPhotons(xAH::PhotonContainer* thisPhoton) {
 
-  xAH::PhotonContainer* thisPhoton = m_photons[photonName];
   thisPhoton->clear();
 
-  this->ClearPhotonsUser(photonName);
+  this->ClearPhotonsUser(thisPhoton->name());
 }
 
 /*********************
@@ -565,46 +753,60 @@ void HelpTreeBase::ClearPhotons(const std::string photonName) {
  *
  *********************/
 
-void HelpTreeBase::AddClusters(const std::string detailStr, const std::string clusterName) {
+xAH::ClusterContainer* HelpTreeBase::AddClusters(const std::string& detailStr, const std::string& clusterName) {
 
   if(m_debug)  Info("AddClusters()", "Adding cluster variables: %s", detailStr.c_str());
 
-  m_clusters[clusterName] = new xAH::ClusterContainer(clusterName, detailStr, m_units, m_isMC);
-
-  xAH::ClusterContainer* thisCluster = m_clusters[clusterName];
+  xAH::ClusterContainer* thisCluster = new xAH::ClusterContainer(clusterName, detailStr, m_units, m_isMC);
+  m_clusters[clusterName] = thisCluster;
 
   thisCluster->setBranches(m_tree);
+  this->setUserHooks();
   this->AddClustersUser(detailStr, clusterName);
+
+  return thisCluster;
 }
 
 
-void HelpTreeBase::FillClusters( const xAOD::CaloClusterContainer* clusters, const std::string clusterName ) {
+void HelpTreeBase::FillClusters( const xAOD::CaloClusterContainer* clusters, const std::string& clusterName ) {
+  this->FillClusters(m_clusters[clusterName], clusters);
+}
+
+void HelpTreeBase::FillClusters( xAH::ClusterContainer* thisCluster, const xAOD::CaloClusterContainer* clusters ) {
 
-  this->ClearClusters(clusterName);
+  this->ClearClusters(thisCluster);
 
   for ( auto cl_itr : *clusters ) {
-    this->FillCluster(cl_itr, clusterName);
+    thisCluster->FillCluster(cl_itr);
+    if ( m_perObjectUserHooks ) this->FillClustersUser(cl_itr, thisCluster->name());
   }
+
+  if ( m_userHooks ) this->FillClusterCollectionUser(clusters, thisCluster);
 }
 
-void HelpTreeBase::FillCluster( const xAOD::CaloCluster* cluster, const std::string clusterName ) {
+void HelpTreeBase::FillCluster( const xAOD::CaloCluster* cluster, const std::string& clusterName ) {
+  this->FillCluster(m_clusters[clusterName], cluster);
+}
 
-  xAH::ClusterContainer* thisCluster = m_clusters[clusterName];
+void HelpTreeBase::FillCluster( xAH::ClusterContainer* thisCluster, const xAOD::CaloCluster* cluster ) {
 
   thisCluster->FillCluster(cluster);
 
-  this->FillClustersUser(cluster, clusterName);
+  if ( m_perObjectUserHooks ) this->FillClustersUser(cluster, thisCluster->name());
 
   return;
 }
 
 
-void HelpTreeBase::ClearClusters(const std::string clusterName) {
+void HelpTreeBase::ClearClusters(const std::string& clusterName) {
+  this->ClearClusters(m_clusters[clusterName]);
+}
+
+void HelpTreeBase::ClearClusters(xAH::ClusterContainer* thisCluster) {
 
-  xAH::ClusterContainer* thisCluster = m_clusters[clusterName];
   thisCluster->clear();
 
-  this->ClearClustersUser(clusterName);
+  this->ClearClustersUser(thisCluster->name());
 }
 
 /*********************
@@ -675,61 +877,88 @@ void HelpTreeBase::ClearL1Jets() {
  *
  ********************/
 
-void HelpTreeBase::AddJets(const std::string detailStr, const std::string jetName)
+xAH::JetContainer* HelpTreeBase::AddJets(const std::string& detailStr, const std::string& jetName)
 {
 
   if(m_debug) Info("AddJets()", "Adding jet %s with variables: %s", jetName.c_str(), detailStr.c_str());
 
-  m_jets[jetName] = new xAH::JetContainer(jetName, detailStr, m_units, m_isMC);
-  m_jets[jetName]->m_debug = m_debug;
+  xAH::JetContainer* thisJet = new xAH::JetContainer(jetName, detailStr, m_units, m_isMC);
+  thisJet->m_debug = m_debug;
+  thisJet->setTrackSelectionCache(&m_trkSelCache);
+  m_jets[jetName] = thisJet;
 
-  xAH::JetContainer* thisJet = m_jets[jetName];
   thisJet->setBranches(m_tree);
+  this->setUserHooks();
   this->AddJetsUser(detailStr, jetName);
 
+  return thisJet;
 }
 
 
-void HelpTreeBase::FillJets( const xAOD::JetContainer* jets, int pvLocation, const std::string jetName ) {
+void HelpTreeBase::FillJets( const xAOD::JetContainer* jets, int pvLocation, const std::string& jetName ) {
+  this->FillJets(m_jets[jetName], jets, pvLocation);
+}
 
-  this->ClearJets(jetName);
+void HelpTreeBase::FillJets( xAH::JetContainer* thisJet, const xAOD::JetContainer* jets, int pvLocation ) {
+
+  this->ClearJets(thisJet);
 
   const xAOD::VertexContainer* vertices(nullptr);
   const xAOD::Vertex *pv = 0;
 
-  xAH::JetContainer* thisJet = m_jets[jetName];
-
   if( thisJet->m_infoSwitch.m_trackPV || thisJet->m_infoSwitch.m_allTrack ) {
     HelperFunctions::retrieve( vertices, m_vertexContainerName, m_event, 0);
     pvLocation = HelperFunctions::getPrimaryVertexLocation( vertices );
     if ( pvLocation >= 0 ) pv = vertices->at( pvLocation );
   }
 
+  this->newTrackSelectionEvent(pv);
+
   for( auto jet_itr : *jets ) {
-    this->FillJet(jet_itr, pv, pvLocation, jetName);
+    thisJet->FillJet(jet_itr, pv, pvLocation);
+    if ( m_perObjectUserHooks ) this->FillJetsUser(jet_itr, thisJet->name());
   }
 
+  if ( m_userHooks ) this->FillJetCollectionUser(jets, thisJet);
+
 }
 
 
 
-void HelpTreeBase::FillJet( const xAOD::Jet* jet_itr, const xAOD::Vertex* pv, int pvLocation, const std::string jetName ) {
+void HelpTreeBase::FillJet( const xAOD::Jet* jet_itr, const xAOD::Vertex* pv, int pvLocation, const std::string& jetName ) {
+  this->FillJet(m_jets[jetName], jet_itr, pv, pvLocation);
+}
 
-  xAH::JetContainer* thisJet = m_jets[jetName];
+void HelpTreeBase::FillJet( xAH::JetContainer* thisJet, const xAOD::Jet* jet_itr, const xAOD::Vertex* pv, int pvLocation ) {
 
+  this->newTrackSelectionEvent(pv);
   thisJet->FillJet(jet_itr, pv, pvLocation);
 
-  this->FillJetsUser(jet_itr, jetName);
+  if ( m_perObjectUserHooks ) this->FillJetsUser(jet_itr, thisJet->name());
 
   return;
 }
 
-void HelpTreeBase::ClearJets(const std::string jetName) {
+void HelpTreeBase::newTrackSelectionEvent( const xAOD::Vertex* pv ) {
+  // the tree entry number does not identify the event (it is not filled for rejected events),
+  // so key the cached decisions on the event passed to FillEvent, and do not share them at all
+  // when FillEvent was not called for this event
+  if ( m_trkSelEventKnown ) {
+    m_trkSelCache.newEvent(m_trkSelRunNumber, m_trkSelEventNumber, pv);
+  } else {
+    m_trkSelCache.clear();
+  }
+}
+
+void HelpTreeBase::ClearJets(const std::string& jetName) {
+  this->ClearJets(m_jets[jetName]);
+}
+
+void HelpTreeBase::ClearJets(xAH::JetContainer* thisJet) {
 
-  xAH::JetContainer* thisJet = m_jets[jetName];
   thisJet->clear();
 
-  this->ClearJetsUser(jetName);
+  this->ClearJetsUser(thisJet->name());
 
 }
 
@@ -739,20 +968,27 @@ void HelpTreeBase::ClearJets(const std::string jetName) {
  *
  ********************/
 
-void HelpTreeBase::AddTruthParts(const std::string truthName, const std::string detailStr)
+xAH::TruthContainer* HelpTreeBase::AddTruthParts(const std::string& truthName, const std::string& detailStr)
 {
 
   if(m_debug) Info("AddTruthParts()", "Adding truth particle %s with variables: %s", truthName.c_str(), detailStr.c_str());
-  m_truth[truthName] = new xAH::TruthContainer(truthName, detailStr, m_units);
+  xAH::TruthContainer* thisTruth = new xAH::TruthContainer(truthName, detailStr, m_units);
+  m_truth[truthName] = thisTruth;
 
-  xAH::TruthContainer* thisTruth = m_truth[truthName];
   thisTruth->setBranches(m_tree);
+  this->setUserHooks();
   this->AddTruthUser(truthName, detailStr);
+
+  return thisTruth;
 }
 
-void HelpTreeBase::FillTruth( const std::string truthName, const xAOD::TruthParticleContainer* truthParts ) {
+void HelpTreeBase::FillTruth( const std::string& truthName, const xAOD::TruthParticleContainer* truthParts ) {
+  this->FillTruth(m_truth[truthName], truthParts);
+}
+
+void HelpTreeBase::FillTruth( xAH::TruthContainer* thisTruth, const xAOD::TruthParticleContainer* truthParts ) {
 
-  this->ClearTruth(truthName);
+  this->ClearTruth(thisTruth);
 
   // We need some basic cuts here to avoid many PseudoRapiditity warnings being thrown ...
   float truthparticle_ptmin  = 2.0;
@@ -764,28 +1000,39 @@ void HelpTreeBase::FillTruth( const std::string truthName, const xAOD::TruthPart
       continue;
     }
 
-    this->FillTruth(truth_itr, truthName);
+    thisTruth->FillTruth(truth_itr);
+    if ( m_perObjectUserHooks ) this->FillTruthUser(thisTruth->name(), truth_itr);
   }
 
+  thisTruth->FillTruthLinks();
+
+  if ( m_userHooks ) this->FillTruthCollectionUser(truthParts, thisTruth);
+
 }
 
-void HelpTreeBase::FillTruth( const xAOD::TruthParticle* truthPart, const std::string truthName )
+void HelpTreeBase::FillTruth( const xAOD::TruthParticle* truthPart, const std::string& truthName )
 {
-  xAH::TruthContainer* thisTruth = m_truth[truthName];
+  this->FillTruth(m_truth[truthName], truthPart);
+}
 
+void HelpTreeBase::FillTruth( xAH::TruthContainer* thisTruth, const xAOD::TruthParticle* truthPart )
+{
   thisTruth->FillTruth(truthPart);
 
-  this->FillTruthUser(truthName, truthPart);
+  if ( m_perObjectUserHooks ) this->FillTruthUser(thisTruth->name(), truthPart);
 
   return;
 }
 
-void HelpTreeBase::ClearTruth(const std::string truthName) {
+void HelpTreeBase::ClearTruth(const std::string& truthName) {
+  this->ClearTruth(m_truth[truthName]);
+}
+
+void HelpTreeBase::ClearTruth(xAH::TruthContainer* thisTruth) {
 
-  xAH::TruthContainer* thisTruth = m_truth[truthName];
   thisTruth->clear();
 
-  this->ClearTruthUser(truthName);
+  this->ClearTruthUser(thisTruth->name());
 
 }
 
@@ -795,19 +1042,26 @@ void HelpTreeBase::ClearTruth(const std::string truthName) {
  *
  ********************/
 
-void HelpTreeBase::AddTrackParts(const std::string trackName, const std::string detailStr)
+xAH::TrackContainer* HelpTreeBase::AddTrackParts(const std::string& trackName, const std::string& detailStr)
 {
   if(m_debug) Info("AddTrackParts()", "Adding track particle %s with variables: %s", trackName.c_str(), detailStr.c_str());
-  m_tracks[trackName] = new xAH::TrackContainer(trackName, detailStr, m_units);
+  xAH::TrackContainer* thisTrack = new xAH::TrackContainer(trackName, detailStr, m_units);
+  m_tracks[trackName] = thisTrack;
 
-  xAH::TrackContainer* thisTrack = m_tracks[trackName];
   thisTrack->setBranches(m_tree);
+  this->setUserHooks();
   this->AddTracksUser(trackName, detailStr);
+
+  return thisTrack;
+}
+
+void HelpTreeBase::FillTracks( const std::string& trackName, const xAOD::TrackParticleContainer* trackParts ) {
+  this->FillTracks(m_tracks[trackName], trackParts);
 }
 
-void HelpTreeBase::FillTracks( const std::string trackName, const xAOD::TrackParticleContainer* trackParts ) {
+void HelpTreeBase::FillTracks( xAH::TrackContainer* thisTrack, const xAOD::TrackParticleContainer* trackParts ) {
 
-  this->ClearTracks(trackName);
+  this->ClearTracks(thisTrack);
 
   // We need some basic cuts here to avoid many PseudoRapiditity warnings being thrown ...
   // float trackparticle_ptmin  = 1.0;
@@ -819,28 +1073,37 @@ void HelpTreeBase::FillTracks( const std::string trackName, const xAOD::TrackPar
     //  continue;
     // }
 
-    this->FillTrack(track_itr, trackName);
+    thisTrack->FillTrack(track_itr);
+    if ( m_perObjectUserHooks ) this->FillTracksUser(thisTrack->name(), track_itr);
   }
 
+  if ( m_userHooks ) this->FillTrackCollectionUser(trackParts, thisTrack);
+
 }
 
-void HelpTreeBase::FillTrack( const xAOD::TrackParticle* trackPart, const std::string trackName )
+void HelpTreeBase::FillTrack( const xAOD::TrackParticle* trackPart, const std::string& trackName )
 {
-  xAH::TrackContainer* thisTrack = m_tracks[trackName];
+  this->FillTrack(m_tracks[trackName], trackPart);
+}
 
+void HelpTreeBase::FillTrack( xAH::TrackContainer* thisTrack, const xAOD::TrackParticle* trackPart )
+{
   thisTrack->FillTrack(trackPart);
 
-  this->FillTracksUser(trackName, trackPart);
+  if ( m_perObjectUserHooks ) this->FillTracksUser(thisTrack->name(), trackPart);
 
   return;
 }
 
-void HelpTreeBase::ClearTracks(const std::string trackName) {
+void HelpTreeBase::ClearTracks(const std::string& trackName) {
+  this->ClearTracks(m_tracks[trackName]);
+}
+
+void HelpTreeBase::ClearTracks(xAH::TrackContainer* thisTrack) {
 
-  xAH::TrackContainer* thisTrack = m_tracks[trackName];
   thisTrack->clear();
 
-  this->ClearTracksUser(trackName);
+  this->ClearTracksUser(thisTrack->name());
 
 }
 
@@ -851,103 +1114,132 @@ void HelpTreeBase::ClearTracks(const std::string trackName) {
  ********************/
 
 // make a unique container:suffix key to lookup the branches in the maps
-std::string HelpTreeBase::FatJetCollectionName(const std::string fatjetName,
-					       const std::string suffix) {
+std::string HelpTreeBase::FatJetCollectionName(const std::string& fatjetName,
+					       const std::string& suffix) {
   return suffix.empty() ? fatjetName : (fatjetName + ":" + suffix);
 }
 
-void HelpTreeBase::AddFatJets(const std::string detailStr, const std::string fatjetName,
-			      const std::string subjetDetailStr,
-			      const std::string suffix) {
+xAH::FatJetContainer* HelpTreeBase::AddFatJets(const std::string& detailStr, const std::string& fatjetName,
+					       const std::string& subjetDetailStr,
+					       const std::string& suffix) {
 
   if(m_debug) Info("AddFatJets()", "Adding fat jet variables: %s", detailStr.c_str());
 
   const std::string collectionName = FatJetCollectionName(fatjetName, suffix);
-  m_fatjets[collectionName] = new xAH::FatJetContainer(fatjetName, detailStr, subjetDetailStr, suffix, m_units, m_isMC);
+  xAH::FatJetContainer* thisFatJet = new xAH::FatJetContainer(fatjetName, detailStr, subjetDetailStr, suffix, m_units, m_isMC);
+  m_fatjets[collectionName] = thisFatJet;
 
-  xAH::FatJetContainer* thisFatJet = m_fatjets[collectionName];
   thisFatJet->setBranches(m_tree);
+  this->setUserHooks();
 
   this->AddFatJetsUser(detailStr, fatjetName, suffix);
+
+  return thisFatJet;
 }
 
-void HelpTreeBase::AddTruthFatJets(const std::string detailStr, const std::string truthFatJetName) {
+xAH::FatJetContainer* HelpTreeBase::AddTruthFatJets(const std::string& detailStr, const std::string& truthFatJetName) {
 
   if(m_debug) Info("AddTruthFatJets()", "Adding fat jet variables: %s", detailStr.c_str());
 
-  m_truth_fatjets[truthFatJetName] = new xAH::FatJetContainer(truthFatJetName, detailStr, "", "", m_units, m_isMC);
+  xAH::FatJetContainer* thisTruthFatJet = new xAH::FatJetContainer(truthFatJetName, detailStr, "", "", m_units, m_isMC);
+  m_truth_fatjets[truthFatJetName] = thisTruthFatJet;
 
-  xAH::FatJetContainer* thisTruthFatJet = m_truth_fatjets[truthFatJetName];
   thisTruthFatJet->setBranches(m_tree);
+  this->setUserHooks();
 
   this->AddTruthFatJetsUser(detailStr, truthFatJetName);
+
+  return thisTruthFatJet;
 }
 
 
-void HelpTreeBase::FillFatJets( const xAOD::JetContainer* fatJets , const std::string fatjetName, const std::string suffix) {
+void HelpTreeBase::FillFatJets( const xAOD::JetContainer* fatJets , const std::string& fatjetName, const std::string& suffix) {
+  this->FillFatJets(m_fatjets[FatJetCollectionName(fatjetName, suffix)], fatJets);
+}
+
+void HelpTreeBase::FillFatJets( xAH::FatJetContainer* thisFatJet, const xAOD::JetContainer* fatJets ) {
 
-  this->ClearFatJets(fatjetName, suffix);
+  this->ClearFatJets(thisFatJet);
 
   for( auto fatjet_itr : *fatJets ) {
 
-    this->FillFatJet(fatjet_itr, fatjetName, suffix);
+    thisFatJet->FillFatJet(fatjet_itr);
+    if ( m_perObjectUserHooks ) this->FillFatJetsUser(fatjet_itr, thisFatJet->name(), thisFatJet->suffix());
 
   } // loop over fat jets
 
+  if ( m_userHooks ) this->FillFatJetCollectionUser(fatJets, thisFatJet);
+
 }
 
-void HelpTreeBase::FillFatJet( const xAOD::Jet* fatjet_itr, const std::string fatjetName, const std::string suffix ) {
+void HelpTreeBase::FillFatJet( const xAOD::Jet* fatjet_itr, const std::string& fatjetName, const std::string& suffix ) {
+  this->FillFatJet(m_fatjets[FatJetCollectionName(fatjetName, suffix)], fatjet_itr);
+}
 
-  const std::string collectionName = FatJetCollectionName(fatjetName, suffix);
-  xAH::FatJetContainer* thisFatJet = m_fatjets[collectionName];
+void HelpTreeBase::FillFatJet( xAH::FatJetContainer* thisFatJet, const xAOD::Jet* fatjet_itr ) {
 
   thisFatJet->FillFatJet(fatjet_itr);
 
-  this->FillFatJetsUser(fatjet_itr, fatjetName, suffix);
+  if ( m_perObjectUserHooks ) this->FillFatJetsUser(fatjet_itr, thisFatJet->name(), thisFatJet->suffix());
 
   return;
 }
 
 
 
-void HelpTreeBase::FillTruthFatJets( const xAOD::JetContainer* truthTruthFatJets, const std::string truthFatJetName ) {
-  this->ClearTruthFatJets(truthFatJetName);
+void HelpTreeBase::FillTruthFatJets( const xAOD::JetContainer* truthTruthFatJets, const std::string& truthFatJetName ) {
+  this->FillTruthFatJets(m_truth_fatjets[truthFatJetName], truthTruthFatJets);
+}
+
+void HelpTreeBase::FillTruthFatJets( xAH::FatJetContainer* thisTruthFatJet, const xAOD::JetContainer* truthTruthFatJets ) {
+
+  this->ClearTruthFatJets(thisTruthFatJet);
 
   for( auto truth_fatjet_itr : *truthTruthFatJets ) {
 
-    this->FillTruthFatJet(truth_fatjet_itr, truthFatJetName);
+    thisTruthFatJet->FillFatJet(truth_fatjet_itr);
+    if ( m_perObjectUserHooks ) this->FillTruthFatJetsUser(truth_fatjet_itr, thisTruthFatJet->name());
 
   } // loop over fat jets
 
+  if ( m_userHooks ) this->FillTruthFatJetCollectionUser(truthTruthFatJets, thisTruthFatJet);
+
 }
 
-void HelpTreeBase::FillTruthFatJet( const xAOD::Jet* truth_fatjet_itr, const std::string truthFatJetName ) {
+void HelpTreeBase::FillTruthFatJet( const xAOD::Jet* truth_fatjet_itr, const std::string& truthFatJetName ) {
+  this->FillTruthFatJet(m_truth_fatjets[truthFatJetName], truth_fatjet_itr);
+}
 
-  xAH::FatJetContainer* thisTruthFatJet = m_truth_fatjets[truthFatJetName];
+void HelpTreeBase::FillTruthFatJet( xAH::FatJetContainer* thisTruthFatJet, const xAOD::Jet* truth_fatjet_itr ) {
 
   thisTruthFatJet->FillFatJet(truth_fatjet_itr);
 
-  this->FillTruthFatJetsUser(truth_fatjet_itr, truthFatJetName);
+  if ( m_perObjectUserHooks ) this->FillTruthFatJetsUser(truth_fatjet_itr, thisTruthFatJet->name());
 
   return;
 }
 
 
-void HelpTreeBase::ClearFatJets(const std::string fatjetName, const std::string suffix) {
-  const std::string collectionName = FatJetCollectionName(fatjetName, suffix);
+void HelpTreeBase::ClearFatJets(const std::string& fatjetName, const std::string& suffix) {
+  this->ClearFatJets(m_fatjets[FatJetCollectionName(fatjetName, suffix)]);
+}
+
+void HelpTreeBase::ClearFatJets(xAH::FatJetContainer* thisFatJet) {
 
-  xAH::FatJetContainer* thisFatJet = m_fatjets[collectionName];
   thisFatJet->clear();
 
-  this->ClearFatJetsUser(fatjetName, suffix);
+  this->ClearFatJetsUser(thisFatJet->name(), thisFatJet->suffix());
+}
+
+void HelpTreeBase::ClearTruthFatJets(const std::string& truthFatJetName) {
+  this->ClearTruthFatJets(m_truth_fatjets[truthFatJetName]);
 }
 
-void HelpTreeBase::ClearTruthFatJets(const std::string truthFatJetName) {
+void HelpTreeBase::ClearTruthFatJets(xAH::FatJetContainer* thisTruthFatJet) {
 
-  xAH::FatJetContainer* thisTruthFatJet = m_truth_fatjets[truthFatJetName];
   thisTruthFatJet->clear();
 
-  this->ClearTruthFatJetsUser(truthFatJetName);
+  this->ClearTruthFatJetsUser(thisTruthFatJet->name());
 }
 
 void HelpTreeBase::ClearEvent() {
@@ -962,43 +1254,56 @@ void HelpTreeBase::ClearEvent() {
  *
  ********************/
 
-void HelpTreeBase::AddTaus(const std::string detailStr, const std::string tauName) {
+xAH::TauContainer* HelpTreeBase::AddTaus(const std::string& detailStr, const std::string& tauName) {
 
   if ( m_debug )  Info("AddTaus()", "Adding tau variables: %s", detailStr.c_str());
 
-  m_taus[tauName] = new xAH::TauContainer(tauName, detailStr, m_units, m_isMC, m_nominalTree);
-
-  xAH::TauContainer* thisTau = m_taus[tauName];
+  xAH::TauContainer* thisTau = new xAH::TauContainer(tauName, detailStr, m_units, m_isMC, m_nominalTree);
+  m_taus[tauName] = thisTau;
 
   thisTau->setBranches(m_tree);
+  this->setUserHooks();
   this->AddTausUser(detailStr, tauName);
+
+  return thisTau;
 }
 
-void HelpTreeBase::FillTaus( const xAOD::TauJetContainer* taus, const std::string tauName ) {
+void HelpTreeBase::FillTaus( const xAOD::TauJetContainer* taus, const std::string& tauName ) {
+  this->FillTaus(m_taus[tauName], taus);
+}
+
+void HelpTreeBase::FillTaus( xAH::TauContainer* thisTau, const xAOD::TauJetContainer* taus ) {
 
-  this->ClearTaus();
+  this->ClearTaus(thisTau);
 
   for( auto tau_itr : *taus ) {
-    this->FillTau(tau_itr, tauName);
+    thisTau->FillTau(tau_itr);
+    if ( m_perObjectUserHooks ) this->FillTausUser(tau_itr, thisTau->name());
   }
+
+  if ( m_userHooks ) this->FillTauCollectionUser(taus, thisTau);
 }
 
-void HelpTreeBase::FillTau( const xAOD::TauJet* tau, const std::string tauName ) {
+void HelpTreeBase::FillTau( const xAOD::TauJet* tau, const std::string& tauName ) {
+  this->FillTau(m_taus[tauName], tau);
+}
 
-  xAH::TauContainer* thisTau = m_taus[tauName];
+void HelpTreeBase::FillTau( xAH::TauContainer* thisTau, const xAOD::TauJet* tau ) {
 
   thisTau->FillTau(tau);
 
-  this->FillTausUser(tau, tauName);
+  if ( m_perObjectUserHooks ) this->FillTausUser(tau, thisTau->name());
 }
 
-void HelpTreeBase::ClearTaus(const std::string tauName) {
+void HelpTreeBase::ClearTaus(const std::string& tauName) {
+  this->ClearTaus(m_taus[tauName]);
+}
 
-  xAH::TauContainer* thisTau = m_taus[tauName];
+void HelpTreeBase::ClearTaus(xAH::TauContainer* thisTau) {
 
   thisTau->clear();
 
-  this->ClearTausUser(tauName);
+  this->ClearTausUser(thisTau->name());
 
 }
 
@@ -1009,36 +1314,42 @@ void HelpTreeBase::ClearTaus(const std::string tauName) {
  *     MET
  *
  ********************/
-void HelpTreeBase::AddMET( const std::string detailStr, const std::string metName ) {
+xAH::MetContainer* HelpTreeBase::AddMET( const std::string& detailStr, const std::string& metName ) {
 
   if(m_debug) Info("AddMET()", "Adding MET variables: %s", detailStr.c_str());
 
-  m_met[metName] = new xAH::MetContainer(metName, detailStr, m_units);
-
-  xAH::MetContainer* thisMet = m_met[metName];
+  xAH::MetContainer* thisMet = new xAH::MetContainer(metName, detailStr, m_units);
+  m_met[metName] = thisMet;
 
   thisMet->setBranches(m_tree);
   this->AddMETUser(detailStr, metName);
+
+  return thisMet;
+}
+
+void HelpTreeBase::FillMET( const xAOD::MissingETContainer* met, const std::string& metName ) {
+  this->FillMET(m_met[metName], met);
 }
 
-void HelpTreeBase::FillMET( const xAOD::MissingETContainer* met, const std::string metName ) {
+void HelpTreeBase::FillMET( xAH::MetContainer* thisMet, const xAOD::MissingETContainer* met ) {
 
   // Clear previous events
-  this->ClearMET(metName);
-
-  xAH::MetContainer* thisMet = m_met[metName];
+  this->ClearMET(thisMet);
 
   thisMet->FillMET(met);
 
-  this->FillMETUser(met, metName);
+  this->FillMETUser(met, thisMet->m_name);
+}
+
+void HelpTreeBase::ClearMET( const std::string& metName ) {
+  this->ClearMET(m_met[metName]);
 }
 
-void HelpTreeBase::ClearMET( const std::string metName ) {
-  xAH::MetContainer* thisMet = m_met[metName];
+void HelpTreeBase::ClearMET( xAH::MetContainer* thisMet ) {
 
   thisMet->clear();
 
-  this->ClearMETUser(metName);
+  this->ClearMETUser(thisMet->m_name);
 }
 
 
@@ -136,6 +136,7 @@ namespace HelperClasses{
     m_menuKeys          = has_exact("menuKeys");
     m_passTriggers      = has_exact("passTriggers");
     m_passTrigBits      = has_exact("passTrigBits");
+    m_passTrigMask      = has_exact("passTrigMask");
     m_prescales         = has_exact("prescales");
     m_prescalesLumi     = has_exact("prescalesLumi");
   }
@@ -158,12 +159,15 @@ namespace HelperClasses{
 
   void MuonInfoSwitch::initialize(){
     m_trigger       = has_exact("trigger");
+    m_trigMatchMask = has_exact("trigMatchMask");
     m_isolation     = has_exact("isolation");
     m_isolationKinematics = has_exact("isolationKinematics");
     m_quality       = has_exact("quality");
     m_trackparams   = has_exact("trackparams");
     m_trackhitcont  = has_exact("trackhitcont");
     m_effSF         = has_exact("effSF");
+    m_effSFFlat     = has_exact("effSFFlat");
+    m_effSFQuant    = has_exact("effSFQuant");
     m_energyLoss    = has_exact("energyLoss");
     m_promptlepton  = has_exact("promptlepton");
 
@@ -197,6 +201,7 @@ namespace HelperClasses{
 
   void ElectronInfoSwitch::initialize(){
     m_trigger       = has_exact("trigger");
+    m_trigMatchMask = has_exact("trigMatchMask");
     m_isolation     = has_exact("isolation");
     m_isolationKinematics = has_exact("isolationKinematics");
     m_quality       = has_exact("quality");
@@ -208,6 +213,8 @@ namespace HelperClasses{
     m_trackparams   = has_exact("trackparams");
     m_trackhitcont  = has_exact("trackhitcont");
     m_effSF         = has_exact("effSF");
+    m_effSFFlat     = has_exact("effSFFlat");
+    m_effSFQuant    = has_exact("effSFQuant");
     m_promptlepton  = has_exact("promptlepton");
     // working points for scale-factors
 
@@ -252,6 +259,7 @@ namespace HelperClasses{
     std::string tmpConfigStr; // temporary config string used to extract multiple values
 
     m_trigger       = has_exact("trigger");
+    m_trigMatchMask = has_exact("trigMatchMask");
     m_substructure  = has_exact("substructure");
     m_bosonCount    = has_exact("bosonCount");
     m_VTags         = has_exact("VTags");
@@ -459,6 +467,7 @@ namespace HelperClasses{
     m_bVtx          = has_exact("bVtx");
     m_parents       = has_exact("parents");
     m_children      = has_exact("children");
+    m_flatLinks     = has_exact("flatLinks");
   }
 
   void TrackInfoSwitch::initialize(){
@@ -158,6 +158,31 @@ void HistogramManager::record(EL::IWorker* wk) {
   }
 }
 
+void HistogramManager::record(TDirectory* dir) {
+  for( auto hist : m_allHists ){
+    std::string name = hist->GetName();
+    TDirectory* histDir = dir;
+    auto slash = name.rfind('/');
+    if( slash != std::string::npos ) {
+      std::string path = name.substr(0, slash);
+      if( !dir->GetDirectory(path.c_str()) ) dir->mkdir(path.c_str());
+      histDir = dir->GetDirectory(path.c_str());
+    }
+    histDir->WriteTObject(hist, name.substr(slash+1).c_str(), "Overwrite");
+  }
+}
+
+StatusCode HistogramManager::merge(const HistogramManager& other) {
+  if( other.m_allHists.size() != m_allHists.size() ) {
+    ANA_MSG_ERROR( "Cannot merge " << other.m_name << " into " << m_name << ": " << other.m_allHists.size() << " histograms instead of " << m_allHists.size() );
+    return StatusCode::FAILURE;
+  }
+  for( unsigned int i = 0; i < m_allHists.size(); i++ ){
+    m_allHists[i]->Add( other.m_allHists[i] );
+  }
+  return StatusCode::SUCCESS;
+}
+
 void HistogramManager::SetLabel(TH1* hist, std::string xlabel)
 {
   hist->GetXaxis()->SetTitle(xlabel.c_str());
@@ -8,515 +8,31 @@ Jet::Jet() : matchedJet(0)
 
 int Jet::is_btag(BTaggerOP op) const
 {
-  switch(op)
-    {
-    case Jet::BTaggerOP::DL1rnn_FixedCutBEff_60:
-      return is_DL1rnn_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1rnn_FixedCutBEff_70:
-      return is_DL1rnn_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1rnn_FixedCutBEff_77:
-      return is_DL1rnn_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1rnn_FixedCutBEff_85:
-      return is_DL1rnn_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1rnn_HybBEff_60:
-      return is_DL1rnn_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1rnn_HybBEff_70:
-      return is_DL1rnn_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1rnn_HybBEff_77:
-      return is_DL1rnn_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1rnn_HybBEff_85:
-      return is_DL1rnn_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1mu_FixedCutBEff_60:
-      return is_DL1mu_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1mu_FixedCutBEff_70:
-      return is_DL1mu_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1mu_FixedCutBEff_77:
-      return is_DL1mu_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1mu_FixedCutBEff_85:
-      return is_DL1mu_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1mu_HybBEff_60:
-      return is_DL1mu_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1mu_HybBEff_70:
-      return is_DL1mu_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1mu_HybBEff_77:
-      return is_DL1mu_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1mu_HybBEff_85:
-      return is_DL1mu_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1r_FixedCutBEff_60:
-      return is_DL1r_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1r_FixedCutBEff_70:
-      return is_DL1r_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1r_FixedCutBEff_77:
-      return is_DL1r_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1r_FixedCutBEff_85:
-      return is_DL1r_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1r_HybBEff_60:
-      return is_DL1r_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1r_HybBEff_70:
-      return is_DL1r_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1r_HybBEff_77:
-      return is_DL1r_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1r_HybBEff_85:
-      return is_DL1r_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1rmu_FixedCutBEff_60:
-      return is_DL1rmu_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1rmu_FixedCutBEff_70:
-      return is_DL1rmu_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1rmu_FixedCutBEff_77:
-      return is_DL1rmu_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1rmu_FixedCutBEff_85:
-      return is_DL1rmu_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1rmu_HybBEff_60:
-      return is_DL1rmu_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1rmu_HybBEff_70:
-      return is_DL1rmu_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1rmu_HybBEff_77:
-      return is_DL1rmu_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1rmu_HybBEff_85:
-      return is_DL1rmu_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1_FixedCutBEff_60:
-      return is_DL1_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1_FixedCutBEff_70:
-      return is_DL1_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1_FixedCutBEff_77:
-      return is_DL1_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1_FixedCutBEff_85:
-      return is_DL1_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1_HybBEff_60:
-      return is_DL1_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1_HybBEff_70:
-      return is_DL1_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1_HybBEff_77:
-      return is_DL1_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1_HybBEff_85:
-      return is_DL1_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_FixedCutBEff_60:
-      return is_MV2c10rnn_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_FixedCutBEff_70:
-      return is_MV2c10rnn_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_FixedCutBEff_77:
-      return is_MV2c10rnn_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_FixedCutBEff_85:
-      return is_MV2c10rnn_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_HybBEff_60:
-      return is_MV2c10rnn_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_HybBEff_70:
-      return is_MV2c10rnn_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_HybBEff_77:
-      return is_MV2c10rnn_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_HybBEff_85:
-      return is_MV2c10rnn_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_FixedCutBEff_60:
-      return is_MV2c10mu_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_FixedCutBEff_70:
-      return is_MV2c10mu_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_FixedCutBEff_77:
-      return is_MV2c10mu_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_FixedCutBEff_85:
-      return is_MV2c10mu_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_HybBEff_60:
-      return is_MV2c10mu_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_HybBEff_70:
-      return is_MV2c10mu_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_HybBEff_77:
-      return is_MV2c10mu_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_HybBEff_85:
-      return is_MV2c10mu_HybBEff_85;
-      break; 
-    case Jet::BTaggerOP::MV2r_FixedCutBEff_60:
-      return is_MV2r_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2r_FixedCutBEff_70:
-      return is_MV2r_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2r_FixedCutBEff_77:
-      return is_MV2r_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2r_FixedCutBEff_85:
-      return is_MV2r_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2r_HybBEff_60:
-      return is_MV2r_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2r_HybBEff_70:
-      return is_MV2r_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2r_HybBEff_77:
-      return is_MV2r_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2r_HybBEff_85:
-      return is_MV2r_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2rmu_FixedCutBEff_60:
-      return is_MV2rmu_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2rmu_FixedCutBEff_70:
-      return is_MV2rmu_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2rmu_FixedCutBEff_77:
-      return is_MV2rmu_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2rmu_FixedCutBEff_85:
-      return is_MV2rmu_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2rmu_HybBEff_60:
-      return is_MV2rmu_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2rmu_HybBEff_70:
-      return is_MV2rmu_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2rmu_HybBEff_77:
-      return is_MV2rmu_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2rmu_HybBEff_85:
-      return is_MV2rmu_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2c10_FixedCutBEff_30:
-      return is_MV2c10_FixedCutBEff_30;
-      break;
-    case Jet::BTaggerOP::MV2c10_FixedCutBEff_50:
-      return is_MV2c10_FixedCutBEff_50;
-      break;
-    case Jet::BTaggerOP::MV2c10_FixedCutBEff_60:
-      return is_MV2c10_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2c10_FixedCutBEff_70:
-      return is_MV2c10_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2c10_FixedCutBEff_77:
-      return is_MV2c10_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2c10_FixedCutBEff_85:
-      return is_MV2c10_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2c10_HybBEff_60:
-      return is_MV2c10_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2c10_HybBEff_70:
-      return is_MV2c10_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2c10_HybBEff_77:
-      return is_MV2c10_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2c10_HybBEff_85:
-      return is_MV2c10_HybBEff_85;
-      break;
-    default:
-      return 0;
-      break;
-    }
+  if(op <= None || op >= NBTaggerOP) return 0;
+  return btagBits.test(op);
 }
 
 const std::vector<float>& Jet::SF_btag(BTaggerOP op) const
 {
-  switch(op)
-    {
-    case Jet::BTaggerOP::DL1rnn_FixedCutBEff_60:
-      return SF_DL1rnn_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1rnn_FixedCutBEff_70:
-      return SF_DL1rnn_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1rnn_FixedCutBEff_77:
-      return SF_DL1rnn_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1rnn_FixedCutBEff_85:
-      return SF_DL1rnn_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1rnn_HybBEff_60:
-      return SF_DL1rnn_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1rnn_HybBEff_70:
-      return SF_DL1rnn_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1rnn_HybBEff_77:
-      return SF_DL1rnn_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1rnn_HybBEff_85:
-      return SF_DL1rnn_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1mu_FixedCutBEff_60:
-      return SF_DL1mu_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1mu_FixedCutBEff_70:
-      return SF_DL1mu_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1mu_FixedCutBEff_77:
-      return SF_DL1mu_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1mu_FixedCutBEff_85:
-      return SF_DL1mu_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1mu_HybBEff_60:
-      return SF_DL1mu_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1mu_HybBEff_70:
-      return SF_DL1mu_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1mu_HybBEff_77:
-      return SF_DL1mu_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1mu_HybBEff_85:
-      return SF_DL1mu_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1r_FixedCutBEff_60:
-      return SF_DL1r_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1r_FixedCutBEff_70:
-      return SF_DL1r_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1r_FixedCutBEff_77:
-      return SF_DL1r_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1r_FixedCutBEff_85:
-      return SF_DL1r_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1r_HybBEff_60:
-      return SF_DL1r_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1r_HybBEff_70:
-      return SF_DL1r_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1r_HybBEff_77:
-      return SF_DL1r_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1r_HybBEff_85:
-      return SF_DL1r_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1rmu_FixedCutBEff_60:
-      return SF_DL1rmu_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1rmu_FixedCutBEff_70:
-      return SF_DL1rmu_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1rmu_FixedCutBEff_77:
-      return SF_DL1rmu_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1rmu_FixedCutBEff_85:
-      return SF_DL1rmu_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1rmu_HybBEff_60:
-      return SF_DL1rmu_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1rmu_HybBEff_70:
-      return SF_DL1rmu_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1rmu_HybBEff_77:
-      return SF_DL1rmu_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1rmu_HybBEff_85:
-      return SF_DL1rmu_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1_FixedCutBEff_60:
-      return SF_DL1_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1_FixedCutBEff_70:
-      return SF_DL1_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1_FixedCutBEff_77:
-      return SF_DL1_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1_FixedCutBEff_85:
-      return SF_DL1_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::DL1_HybBEff_60:
-      return SF_DL1_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::DL1_HybBEff_70:
-      return SF_DL1_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::DL1_HybBEff_77:
-      return SF_DL1_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::DL1_HybBEff_85:
-      return SF_DL1_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_FixedCutBEff_60:
-      return SF_MV2c10rnn_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_FixedCutBEff_70:
-      return SF_MV2c10rnn_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_FixedCutBEff_77:
-      return SF_MV2c10rnn_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_FixedCutBEff_85:
-      return SF_MV2c10rnn_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_HybBEff_60:
-      return SF_MV2c10rnn_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_HybBEff_70:
-      return SF_MV2c10rnn_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_HybBEff_77:
-      return SF_MV2c10rnn_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2c10rnn_HybBEff_85:
-      return SF_MV2c10rnn_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_FixedCutBEff_60:
-      return SF_MV2c10mu_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_FixedCutBEff_70:
-      return SF_MV2c10mu_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_FixedCutBEff_77:
-      return SF_MV2c10mu_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_FixedCutBEff_85:
-      return SF_MV2c10mu_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_HybBEff_60:
-      return SF_MV2c10mu_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_HybBEff_70:
-      return SF_MV2c10mu_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_HybBEff_77:
-      return SF_MV2c10mu_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2c10mu_HybBEff_85:
-      return SF_MV2c10mu_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2r_FixedCutBEff_60:
-      return SF_MV2r_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2r_FixedCutBEff_70:
-      return SF_MV2r_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2r_FixedCutBEff_77:
-      return SF_MV2r_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2r_FixedCutBEff_85:
-      return SF_MV2r_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2r_HybBEff_60:
-      return SF_MV2r_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2r_HybBEff_70:
-      return SF_MV2r_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2r_HybBEff_77:
-      return SF_MV2r_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2r_HybBEff_85:
-      return SF_MV2r_HybBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2rmu_FixedCutBEff_60:
-      return SF_MV2rmu_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2rmu_FixedCutBEff_70:
-      return SF_MV2rmu_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2rmu_FixedCutBEff_77:
-      return SF_MV2rmu_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2rmu_FixedCutBEff_85:
-      return SF_MV2rmu_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2rmu_HybBEff_60:
-      return SF_MV2rmu_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2rmu_HybBEff_70:
-      return SF_MV2rmu_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2rmu_HybBEff_77:
-      return SF_MV2rmu_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2rmu_HybBEff_85:
-      return SF_MV2rmu_HybBEff_85;
-      break;  
-    case Jet::BTaggerOP::MV2c10_FixedCutBEff_30:
-      return SF_MV2c10_FixedCutBEff_30;
-      break;
-    case Jet::BTaggerOP::MV2c10_FixedCutBEff_50:
-      return SF_MV2c10_FixedCutBEff_50;
-      break;
-    case Jet::BTaggerOP::MV2c10_FixedCutBEff_60:
-      return SF_MV2c10_FixedCutBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2c10_FixedCutBEff_70:
-      return SF_MV2c10_FixedCutBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2c10_FixedCutBEff_77:
-      return SF_MV2c10_FixedCutBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2c10_FixedCutBEff_85:
-      return SF_MV2c10_FixedCutBEff_85;
-      break;
-    case Jet::BTaggerOP::MV2c10_HybBEff_60:
-      return SF_MV2c10_HybBEff_60;
-      break;
-    case Jet::BTaggerOP::MV2c10_HybBEff_70:
-      return SF_MV2c10_HybBEff_70;
-      break;
-    case Jet::BTaggerOP::MV2c10_HybBEff_77:
-      return SF_MV2c10_HybBEff_77;
-      break;
-    case Jet::BTaggerOP::MV2c10_HybBEff_85:
-      return SF_MV2c10_HybBEff_85;
-      break;
-    default:
-      static const std::vector<float> dummySF = {1.};
-      return dummySF;
-      break;
-    }
+  for(const auto& sf : btagSFs)
+    if(sf.first == op) return sf.second;
+
+  static const std::vector<float> dummySF = {1.};
+  return dummySF;
+}
+
+void Jet::setBtag(unsigned int iOP, BTaggerOP op, int isTag, const std::vector<float>& sf)
+{
+  btagBits.set(op, isTag > 0);
+  if(btagSFs.size() <= iOP) btagSFs.resize(iOP+1);
+  btagSFs[iOP].first  = op;
+  btagSFs[iOP].second = sf; // reuses the capacity of the previous entry
+}
+
+const Jet::IPTrackDetails& Jet::ipTrackDetails() const
+{
+  static const IPTrackDetails empty;
+  return ipTracks ? *ipTracks.get() : empty;
 }
 
 
@@ -7,7 +7,8 @@ using namespace xAH;
 
 JetContainer::JetContainer(const std::string& name, const std::string& detailStr, float units, bool mc)
   : ParticleContainer(name,detailStr,units,mc),
-    m_trkSelTool(nullptr)
+    m_trkSelTool(nullptr),
+    m_trkSelCache(nullptr)
 
 {
   // rapidity
@@ -846,6 +847,7 @@ void JetContainer::setTree(TTree *tree)
   //
   // Connect branches
   ParticleContainer::setTree(tree);
+  if ( m_lazy ) return;
 
   if(m_infoSwitch.m_rapidity)
     {
@@ -858,6 +860,10 @@ void JetContainer::setTree(TTree *tree)
     connectBranch<std::string>      (tree, "listTrigChains",       &m_listTrigChains );
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    connectTrigMatchMaskBranch(tree);
+  }
+
   if(m_infoSwitch.m_clean || m_infoSwitch.m_cleanLight || m_infoSwitch.m_cleanNoSumm)
     {
       if(m_infoSwitch.m_clean || m_infoSwitch.m_cleanNoSumm){
@@ -1098,6 +1104,10 @@ void JetContainer::updateParticle(uint idx, Jet& jet)
     jet.listTrigChains        =     m_listTrigChains        ->at(idx);
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    jet.trigMatchMask         =     m_trigMatchMask         ->at(idx);
+  }
+
   if(m_infoSwitch.m_clean || m_infoSwitch.m_cleanLight || m_infoSwitch.m_cleanNoSumm)
     {
       if(m_debug) std::cout << "updating clean " << std::endl;
@@ -1277,13 +1287,15 @@ void JetContainer::updateParticle(uint idx, Jet& jet)
     jet.IP2D_cu                          = m_IP2D_cu                   ->at(idx);
     jet.nIP2DTracks                      = m_IP2D_gradeOfTracks        ->at(idx).size();
 
-    jet.IP2D_gradeOfTracks               = m_IP2D_gradeOfTracks        ->at(idx);
-    jet.IP2D_flagFromV0ofTracks          = m_IP2D_flagFromV0ofTracks   ->at(idx);
-    jet.IP2D_valD0wrtPVofTracks          = m_IP2D_valD0wrtPVofTracks   ->at(idx);
-    jet.IP2D_sigD0wrtPVofTracks          = m_IP2D_sigD0wrtPVofTracks   ->at(idx);
-    jet.IP2D_weightBofTracks             = m_IP2D_weightBofTracks      ->at(idx);
-    jet.IP2D_weightCofTracks             = m_IP2D_weightCofTracks      ->at(idx);
-    jet.IP2D_weightUofTracks             = m_IP2D_weightUofTracks      ->at(idx);
+    Jet::IPTrackDetails& ipTracks = jet.ipTracks.fill();
+
+    ipTracks.IP2D_gradeOfTracks          = m_IP2D_gradeOfTracks        ->at(idx);
+    ipTracks.IP2D_flagFromV0ofTracks     = m_IP2D_flagFromV0ofTracks   ->at(idx);
+    ipTracks.IP2D_valD0wrtPVofTracks     = m_IP2D_valD0wrtPVofTracks   ->at(idx);
+    ipTracks.IP2D_sigD0wrtPVofTracks     = m_IP2D_sigD0wrtPVofTracks   ->at(idx);
+    ipTracks.IP2D_weightBofTracks        = m_IP2D_weightBofTracks      ->at(idx);
+    ipTracks.IP2D_weightCofTracks        = m_IP2D_weightCofTracks      ->at(idx);
+    ipTracks.IP2D_weightUofTracks        = m_IP2D_weightUofTracks      ->at(idx);
 
     jet.IP3D                             = m_IP3D                      ->at(idx);
     jet.IP3D_pu                          = m_IP3D_pu                   ->at(idx);
@@ -1292,381 +1304,23 @@ void JetContainer::updateParticle(uint idx, Jet& jet)
     jet.IP3D_c                           = m_IP3D_c                    ->at(idx);
     jet.IP3D_cu                          = m_IP3D_cu                   ->at(idx);
     jet.nIP3DTracks                      = m_IP3D_gradeOfTracks        ->at(idx).size();
-    jet.IP3D_gradeOfTracks               = m_IP3D_gradeOfTracks        ->at(idx);
-    jet.IP3D_flagFromV0ofTracks          = m_IP3D_flagFromV0ofTracks   ->at(idx);
-    jet.IP3D_valD0wrtPVofTracks          = m_IP3D_valD0wrtPVofTracks   ->at(idx);
-    jet.IP3D_sigD0wrtPVofTracks          = m_IP3D_sigD0wrtPVofTracks   ->at(idx);
-    jet.IP3D_valZ0wrtPVofTracks          = m_IP3D_valZ0wrtPVofTracks   ->at(idx);
-    jet.IP3D_sigZ0wrtPVofTracks          = m_IP3D_sigZ0wrtPVofTracks   ->at(idx);
-    jet.IP3D_weightBofTracks             = m_IP3D_weightBofTracks      ->at(idx);
-    jet.IP3D_weightCofTracks             = m_IP3D_weightCofTracks      ->at(idx);
-    jet.IP3D_weightUofTracks             = m_IP3D_weightUofTracks      ->at(idx);
+    ipTracks.IP3D_gradeOfTracks          = m_IP3D_gradeOfTracks        ->at(idx);
+    ipTracks.IP3D_flagFromV0ofTracks     = m_IP3D_flagFromV0ofTracks   ->at(idx);
+    ipTracks.IP3D_valD0wrtPVofTracks     = m_IP3D_valD0wrtPVofTracks   ->at(idx);
+    ipTracks.IP3D_sigD0wrtPVofTracks     = m_IP3D_sigD0wrtPVofTracks   ->at(idx);
+    ipTracks.IP3D_valZ0wrtPVofTracks     = m_IP3D_valZ0wrtPVofTracks   ->at(idx);
+    ipTracks.IP3D_sigZ0wrtPVofTracks     = m_IP3D_sigZ0wrtPVofTracks   ->at(idx);
+    ipTracks.IP3D_weightBofTracks        = m_IP3D_weightBofTracks      ->at(idx);
+    ipTracks.IP3D_weightCofTracks        = m_IP3D_weightCofTracks      ->at(idx);
+    ipTracks.IP3D_weightUofTracks        = m_IP3D_weightUofTracks      ->at(idx);
   }
 
   static const std::vector<float> dummy1 = {1.};
-  for(auto btag : m_btags)
+  for(unsigned int iOP = 0; iOP < m_btags.size(); iOP++)
     {
-      switch(btag->m_op)
-	{
-	case Jet::BTaggerOP::DL1rnn_FixedCutBEff_60:
-	  jet.is_DL1rnn_FixedCutBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rnn_FixedCutBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rnn_FixedCutBEff_70:
-	  jet.is_DL1rnn_FixedCutBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rnn_FixedCutBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rnn_FixedCutBEff_77:
-	  jet.is_DL1rnn_FixedCutBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rnn_FixedCutBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rnn_FixedCutBEff_85:
-	  jet.is_DL1rnn_FixedCutBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rnn_FixedCutBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rnn_HybBEff_60:
-	  jet.is_DL1rnn_HybBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rnn_HybBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rnn_HybBEff_70:
-	  jet.is_DL1rnn_HybBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rnn_HybBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rnn_HybBEff_77:
-	  jet.is_DL1rnn_HybBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rnn_HybBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rnn_HybBEff_85:
-	  jet.is_DL1rnn_HybBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rnn_HybBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1mu_FixedCutBEff_60:
-	  jet.is_DL1mu_FixedCutBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_DL1mu_FixedCutBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1mu_FixedCutBEff_70:
-	  jet.is_DL1mu_FixedCutBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_DL1mu_FixedCutBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1mu_FixedCutBEff_77:
-	  jet.is_DL1mu_FixedCutBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_DL1mu_FixedCutBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1mu_FixedCutBEff_85:
-	  jet.is_DL1mu_FixedCutBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_DL1mu_FixedCutBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1mu_HybBEff_60:
-	  jet.is_DL1mu_HybBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_DL1mu_HybBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1mu_HybBEff_70:
-	  jet.is_DL1mu_HybBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_DL1mu_HybBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1mu_HybBEff_77:
-	  jet.is_DL1mu_HybBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_DL1mu_HybBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1mu_HybBEff_85:
-	  jet.is_DL1mu_HybBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_DL1mu_HybBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-    case Jet::BTaggerOP::DL1rmu_FixedCutBEff_60:
-	  jet.is_DL1rmu_FixedCutBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rmu_FixedCutBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rmu_FixedCutBEff_70:
-	  jet.is_DL1rmu_FixedCutBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rmu_FixedCutBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rmu_FixedCutBEff_77:
-	  jet.is_DL1rmu_FixedCutBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rmu_FixedCutBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rmu_FixedCutBEff_85:
-	  jet.is_DL1rmu_FixedCutBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rmu_FixedCutBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rmu_HybBEff_60:
-	  jet.is_DL1rmu_HybBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rmu_HybBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rmu_HybBEff_70:
-	  jet.is_DL1rmu_HybBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rmu_HybBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rmu_HybBEff_77:
-	  jet.is_DL1rmu_HybBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rmu_HybBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1rmu_HybBEff_85:
-	  jet.is_DL1rmu_HybBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_DL1rmu_HybBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-    case Jet::BTaggerOP::DL1r_FixedCutBEff_60:
-	  jet.is_DL1r_FixedCutBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_DL1r_FixedCutBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1r_FixedCutBEff_70:
-	  jet.is_DL1r_FixedCutBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_DL1r_FixedCutBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1r_FixedCutBEff_77:
-	  jet.is_DL1r_FixedCutBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_DL1r_FixedCutBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1r_FixedCutBEff_85:
-	  jet.is_DL1r_FixedCutBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_DL1r_FixedCutBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1r_HybBEff_60:
-	  jet.is_DL1r_HybBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_DL1r_HybBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1r_HybBEff_70:
-	  jet.is_DL1r_HybBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_DL1r_HybBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1r_HybBEff_77:
-	  jet.is_DL1r_HybBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_DL1r_HybBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1r_HybBEff_85:
-	  jet.is_DL1r_HybBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_DL1r_HybBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1_FixedCutBEff_60:
-	  jet.is_DL1_FixedCutBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_DL1_FixedCutBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1_FixedCutBEff_70:
-	  jet.is_DL1_FixedCutBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_DL1_FixedCutBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1_FixedCutBEff_77:
-	  jet.is_DL1_FixedCutBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_DL1_FixedCutBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1_FixedCutBEff_85:
-	  jet.is_DL1_FixedCutBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_DL1_FixedCutBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1_HybBEff_60:
-	  jet.is_DL1_HybBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_DL1_HybBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1_HybBEff_70:
-	  jet.is_DL1_HybBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_DL1_HybBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1_HybBEff_77:
-	  jet.is_DL1_HybBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_DL1_HybBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::DL1_HybBEff_85:
-	  jet.is_DL1_HybBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_DL1_HybBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10rnn_FixedCutBEff_60:
-	  jet.is_MV2c10rnn_FixedCutBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10rnn_FixedCutBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10rnn_FixedCutBEff_70:
-	  jet.is_MV2c10rnn_FixedCutBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10rnn_FixedCutBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10rnn_FixedCutBEff_77:
-	  jet.is_MV2c10rnn_FixedCutBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10rnn_FixedCutBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10rnn_FixedCutBEff_85:
-	  jet.is_MV2c10rnn_FixedCutBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10rnn_FixedCutBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10rnn_HybBEff_60:
-	  jet.is_MV2c10rnn_HybBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10rnn_HybBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10rnn_HybBEff_70:
-	  jet.is_MV2c10rnn_HybBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10rnn_HybBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10rnn_HybBEff_77:
-	  jet.is_MV2c10rnn_HybBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10rnn_HybBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10rnn_HybBEff_85:
-	  jet.is_MV2c10rnn_HybBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10rnn_HybBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10mu_FixedCutBEff_60:
-	  jet.is_MV2c10mu_FixedCutBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10mu_FixedCutBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10mu_FixedCutBEff_70:
-	  jet.is_MV2c10mu_FixedCutBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10mu_FixedCutBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10mu_FixedCutBEff_77:
-	  jet.is_MV2c10mu_FixedCutBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10mu_FixedCutBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10mu_FixedCutBEff_85:
-	  jet.is_MV2c10mu_FixedCutBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10mu_FixedCutBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10mu_HybBEff_60:
-	  jet.is_MV2c10mu_HybBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10mu_HybBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10mu_HybBEff_70:
-	  jet.is_MV2c10mu_HybBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10mu_HybBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10mu_HybBEff_77:
-	  jet.is_MV2c10mu_HybBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10mu_HybBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10mu_HybBEff_85:
-	  jet.is_MV2c10mu_HybBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10mu_HybBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-    case Jet::BTaggerOP::MV2r_FixedCutBEff_60:
-	  jet.is_MV2r_FixedCutBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_MV2r_FixedCutBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2r_FixedCutBEff_70:
-	  jet.is_MV2r_FixedCutBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_MV2r_FixedCutBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2r_FixedCutBEff_77:
-	  jet.is_MV2r_FixedCutBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_MV2r_FixedCutBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2r_FixedCutBEff_85:
-	  jet.is_MV2r_FixedCutBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_MV2r_FixedCutBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2r_HybBEff_60:
-	  jet.is_MV2r_HybBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_MV2r_HybBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2r_HybBEff_70:
-	  jet.is_MV2r_HybBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_MV2r_HybBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2r_HybBEff_77:
-	  jet.is_MV2r_HybBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_MV2r_HybBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2r_HybBEff_85:
-	  jet.is_MV2r_HybBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_MV2r_HybBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2rmu_FixedCutBEff_60:
-	  jet.is_MV2rmu_FixedCutBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_MV2rmu_FixedCutBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2rmu_FixedCutBEff_70:
-	  jet.is_MV2rmu_FixedCutBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_MV2rmu_FixedCutBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2rmu_FixedCutBEff_77:
-	  jet.is_MV2rmu_FixedCutBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_MV2rmu_FixedCutBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2rmu_FixedCutBEff_85:
-	  jet.is_MV2rmu_FixedCutBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_MV2rmu_FixedCutBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2rmu_HybBEff_60:
-	  jet.is_MV2rmu_HybBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_MV2rmu_HybBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2rmu_HybBEff_70:
-	  jet.is_MV2rmu_HybBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_MV2rmu_HybBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2rmu_HybBEff_77:
-	  jet.is_MV2rmu_HybBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_MV2rmu_HybBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2rmu_HybBEff_85:
-	  jet.is_MV2rmu_HybBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_MV2rmu_HybBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FixedCutBEff_30:
-	  jet.is_MV2c10_FixedCutBEff_30=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FixedCutBEff_30=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FixedCutBEff_50:
-	  jet.is_MV2c10_FixedCutBEff_50=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FixedCutBEff_50=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FixedCutBEff_60:
-	  jet.is_MV2c10_FixedCutBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FixedCutBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FixedCutBEff_70:
-	  jet.is_MV2c10_FixedCutBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FixedCutBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FixedCutBEff_77:
-	  jet.is_MV2c10_FixedCutBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FixedCutBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FixedCutBEff_85:
-	  jet.is_MV2c10_FixedCutBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FixedCutBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FixedCutBEff_90:
-	  jet.is_MV2c10_FixedCutBEff_90=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FixedCutBEff_90=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FlatBEff_30:
-	  jet.is_MV2c10_FlatBEff_30=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FlatBEff_30=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FlatBEff_50:
-	  jet.is_MV2c10_FlatBEff_50=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FlatBEff_50=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FlatBEff_60:
-	  jet.is_MV2c10_FlatBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FlatBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FlatBEff_70:
-	  jet.is_MV2c10_FlatBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FlatBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FlatBEff_77:
-	  jet.is_MV2c10_FlatBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FlatBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_FlatBEff_85:
-	  jet.is_MV2c10_FlatBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_FlatBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_HybBEff_60:
-	  jet.is_MV2c10_HybBEff_60=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_HybBEff_60=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_HybBEff_70:
-	  jet.is_MV2c10_HybBEff_70=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_HybBEff_70=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_HybBEff_77:
-	  jet.is_MV2c10_HybBEff_77=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_HybBEff_77=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	case Jet::BTaggerOP::MV2c10_HybBEff_85:
-	  jet.is_MV2c10_HybBEff_85=       btag->m_isTag->at(idx);
-	  jet.SF_MV2c10_HybBEff_85=(m_mc)?btag->m_sf   ->at(idx):dummy1;
-	  break;
-	default:
-	  break;
-	}
+      const btagOpPoint* btag = m_btags.at(iOP);
+      if(btag->m_op == Jet::BTaggerOP::None) continue;
+      jet.setBtag(iOP, btag->m_op, btag->m_isTag->at(idx), (m_mc)?btag->m_sf->at(idx):dummy1);
     }
 
   // truth
@@ -1715,6 +1369,11 @@ void JetContainer::setBranches(TTree *tree)
     setBranch<std::string>(tree, "listTrigChains", m_listTrigChains );
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    // one bit per chain, the chain names are stored once in the tree UserInfo
+    setTrigMatchMaskBranch(tree);
+  }
+
   if( m_infoSwitch.m_clean || m_infoSwitch.m_cleanLight || m_infoSwitch.m_cleanNoSumm ) {
     if(m_infoSwitch.m_clean || m_infoSwitch.m_cleanNoSumm ){
       setBranch<float>(tree,"Timing",                        m_Timing               );
@@ -2109,6 +1768,10 @@ void JetContainer::clear()
     m_isTrigMatchedToChain->clear();
     m_listTrigChains->clear();
   }
+
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    m_trigMatchMask->clear();
+  }
   
   // clean
   if( m_infoSwitch.m_clean || m_infoSwitch.m_cleanLight || m_infoSwitch.m_cleanNoSumm ) {
@@ -2497,6 +2160,11 @@ void JetContainer::FillJet( const xAOD::IParticle* particle, const xAOD::Vertex*
     m_rapidity->push_back( jet->rapidity() );
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    static SG::AuxElement::ConstAccessor< std::map<std::string,char> > acc_isTrigMatchedMap("isTrigMatchedMapJet");
+    fillTrigMatchMask( acc_isTrigMatchedMap.isAvailable( *jet ) ? &acc_isTrigMatchedMap( *jet ) : nullptr );
+  }
+
   if ( m_infoSwitch.m_trigger ) {
 
     // retrieve map<string,char> w/ <chain,isMatched>
@@ -2945,21 +2613,28 @@ void JetContainer::FillJet( const xAOD::IParticle* particle, const xAOD::Vertex*
     std::vector<int> nNIMLPixSplitHits;
     static SG::AuxElement::ConstAccessor< std::vector<ElementLink<DataVector<xAOD::IParticle> > > >ghostTrack ("GhostTrack");
     if ( ghostTrack.isAvailable( *jet ) ) {
-      std::vector<ElementLink<DataVector<xAOD::IParticle> > > trackLinks = ghostTrack( *jet );
+      const std::vector<ElementLink<DataVector<xAOD::IParticle> > >& trackLinks = ghostTrack( *jet );
       //std::vector<float> pt(trackLinks.size(),-999);
-      for ( auto link_itr : trackLinks ) {
+      for ( const auto& link_itr : trackLinks ) {
         if( !link_itr.isValid() ) { continue; }
-        const xAOD::TrackParticle* track = dynamic_cast<const xAOD::TrackParticle*>( *link_itr );
+        // ghost tracks always link into a TrackParticleContainer
+        const xAOD::TrackParticle* track = static_cast<const xAOD::TrackParticle*>( *link_itr );
         // if asking for tracks passing PV selection ( i.e. JVF JVT tracks )
         if( m_infoSwitch.m_allTrackPVSel ) {
-          // PV selection from
-          // https://twiki.cern.ch/twiki/bin/view/AtlasProtected/JvtManualRecalculation
-          if( track->pt() < 500 )                { continue; } // pT cut
-          if( !m_trkSelTool->accept(*track,pv) ) { continue; } // ID quality cut
-          if( track->vertex() != pv ) {                        // if not in PV vertex fit
-            if( track->vertex() != 0 )           { continue; } // make sure in no vertex fits
-            if( fabs((track->z0()+track->vz()-pv->z())*sin(track->theta())) > 3.0 ) { continue; } // make sure close to PV in z
+          // the same tracks are ghost-associated to every jet collection, use the decision of the event if known
+          TrackSelectionCache::Decision decision = m_trkSelCache ? m_trkSelCache->decision(track) : TrackSelectionCache::Unknown;
+          if( decision == TrackSelectionCache::Unknown ) {
+            // PV selection from
+            // https://twiki.cern.ch/twiki/bin/view/AtlasProtected/JvtManualRecalculation
+            bool pass = track->pt() >= 500                        // pT cut
+                     && m_trkSelTool->accept(*track,pv)            // ID quality cut
+                     && ( track->vertex() == pv ||                 // in PV vertex fit, or
+                          ( track->vertex() == 0 &&                // in no vertex fit and close to PV in z
+                            fabs((track->z0()+track->vz()-pv->z())*sin(track->theta())) <= 3.0 ) );
+            if( m_trkSelCache ) m_trkSelCache->setDecision(track, pass);
+            decision = pass ? TrackSelectionCache::Pass : TrackSelectionCache::Fail;
           }
+          if( decision == TrackSelectionCache::Fail ) { continue; }
         }
         pt. push_back( track->pt() / m_units );
         qOverP.push_back( track->qOverP() * m_units );
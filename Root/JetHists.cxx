@@ -1989,17 +1989,19 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
 
 
   if(m_infoSwitch->m_ipDetails){
+    const xAH::Jet::IPTrackDetails& ipTracks = jet->ipTrackDetails();
+
     //
     // IP2D
     //
     m_nIP2DTracks -> Fill( jet->nIP2DTracks, eventWeight);
-    for(float grade : jet->IP2D_gradeOfTracks)        m_IP2D_gradeOfTracks->Fill(grade, eventWeight);
-    for(float flag  : jet->IP2D_flagFromV0ofTracks)   m_IP2D_flagFromV0ofTracks->Fill(flag, eventWeight);
+    for(float grade : ipTracks.IP2D_gradeOfTracks)        m_IP2D_gradeOfTracks->Fill(grade, eventWeight);
+    for(float flag  : ipTracks.IP2D_flagFromV0ofTracks)   m_IP2D_flagFromV0ofTracks->Fill(flag, eventWeight);
 
-    if(jet->IP2D_sigD0wrtPVofTracks.size()  == jet->IP2D_valD0wrtPVofTracks.size()){
-      for(unsigned int i=0; i<jet->IP2D_sigD0wrtPVofTracks.size(); i++){
-	float d0Sig=jet->IP2D_sigD0wrtPVofTracks[i];
-	float d0Val=jet->IP2D_valD0wrtPVofTracks[i];
+    if(ipTracks.IP2D_sigD0wrtPVofTracks.size()  == ipTracks.IP2D_valD0wrtPVofTracks.size()){
+      for(unsigned int i=0; i<ipTracks.IP2D_sigD0wrtPVofTracks.size(); i++){
+	float d0Sig=ipTracks.IP2D_sigD0wrtPVofTracks[i];
+	float d0Val=ipTracks.IP2D_valD0wrtPVofTracks[i];
 	float d0Err=d0Val/d0Sig;
 	m_IP2D_errD0wrtPVofTracks->Fill  (d0Err, eventWeight);
 	m_IP2D_sigD0wrtPVofTracks->Fill  (d0Sig, eventWeight);
@@ -2008,9 +2010,9 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
       }
     }
 
-    for(float weightB : jet->IP2D_weightBofTracks)  m_IP2D_weightBofTracks->Fill(weightB, eventWeight);
-    for(float weightC : jet->IP2D_weightCofTracks)  m_IP2D_weightCofTracks->Fill(weightC, eventWeight);
-    for(float weightU : jet->IP2D_weightUofTracks)  m_IP2D_weightUofTracks->Fill(weightU, eventWeight);
+    for(float weightB : ipTracks.IP2D_weightBofTracks)  m_IP2D_weightBofTracks->Fill(weightB, eventWeight);
+    for(float weightC : ipTracks.IP2D_weightCofTracks)  m_IP2D_weightCofTracks->Fill(weightC, eventWeight);
+    for(float weightU : ipTracks.IP2D_weightUofTracks)  m_IP2D_weightUofTracks->Fill(weightU, eventWeight);
 
 
     m_IP2D_pu         ->  Fill(jet->IP2D_pu  , eventWeight );
@@ -2026,12 +2028,12 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
     // IP3D
     //
     m_nIP3DTracks -> Fill( jet->nIP3DTracks, eventWeight);
-    for(float grade : jet->IP3D_gradeOfTracks     )   m_IP3D_gradeOfTracks->Fill(grade, eventWeight);
-    for(float flag  : jet->IP3D_flagFromV0ofTracks)   m_IP3D_flagFromV0ofTracks->Fill(flag, eventWeight);
+    for(float grade : ipTracks.IP3D_gradeOfTracks     )   m_IP3D_gradeOfTracks->Fill(grade, eventWeight);
+    for(float flag  : ipTracks.IP3D_flagFromV0ofTracks)   m_IP3D_flagFromV0ofTracks->Fill(flag, eventWeight);
 
-    for(unsigned int i=0; i<jet->IP3D_sigD0wrtPVofTracks.size(); i++){
-      float d0Sig=jet->IP3D_sigD0wrtPVofTracks[i];
-      float d0Val=jet->IP3D_valD0wrtPVofTracks[i];
+    for(unsigned int i=0; i<ipTracks.IP3D_sigD0wrtPVofTracks.size(); i++){
+      float d0Sig=ipTracks.IP3D_sigD0wrtPVofTracks[i];
+      float d0Val=ipTracks.IP3D_valD0wrtPVofTracks[i];
       float d0Err=d0Val/d0Sig;
       m_IP3D_errD0wrtPVofTracks->Fill  (d0Err, eventWeight);
       m_IP3D_sigD0wrtPVofTracks->Fill  (d0Sig, eventWeight);
@@ -2039,9 +2041,9 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
       m_IP3D_valD0wrtPVofTracks->Fill  (d0Val, eventWeight);
     }
 
-    for(unsigned int i=0; i<jet->IP3D_sigZ0wrtPVofTracks.size(); i++){
-      float z0Sig=jet->IP3D_sigZ0wrtPVofTracks[i];
-      float z0Val=jet->IP3D_valZ0wrtPVofTracks[i];
+    for(unsigned int i=0; i<ipTracks.IP3D_sigZ0wrtPVofTracks.size(); i++){
+      float z0Sig=ipTracks.IP3D_sigZ0wrtPVofTracks[i];
+      float z0Val=ipTracks.IP3D_valZ0wrtPVofTracks[i];
       float z0Err=z0Val/z0Sig;
       m_IP3D_errZ0wrtPVofTracks->Fill  (z0Err, eventWeight);
       m_IP3D_sigZ0wrtPVofTracks->Fill  (z0Sig, eventWeight);
@@ -2049,9 +2051,9 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
       m_IP3D_valZ0wrtPVofTracks->Fill  (z0Val, eventWeight);
     }
 
-    for(float weightB : jet->IP3D_weightBofTracks)  m_IP3D_weightBofTracks->Fill(weightB, eventWeight);
-    for(float weightC : jet->IP3D_weightCofTracks)  m_IP3D_weightCofTracks->Fill(weightC, eventWeight);
-    for(float weightU : jet->IP3D_weightUofTracks)  m_IP3D_weightUofTracks->Fill(weightU, eventWeight);
+    for(float weightB : ipTracks.IP3D_weightBofTracks)  m_IP3D_weightBofTracks->Fill(weightB, eventWeight);
+    for(float weightC : ipTracks.IP3D_weightCofTracks)  m_IP3D_weightCofTracks->Fill(weightC, eventWeight);
+    for(float weightU : ipTracks.IP3D_weightUofTracks)  m_IP3D_weightUofTracks->Fill(weightU, eventWeight);
 
     m_IP3D_pu         ->  Fill(jet->IP3D_pu  , eventWeight );
     m_IP3D_pb         ->  Fill(jet->IP3D_pb  , eventWeight );
@@ -144,6 +144,7 @@ EL::StatusCode JetSelector :: initialize ()
     m_jet_cutflow_jvt_cut         = m_jet_cutflowHist_1->GetXaxis()->FindBin("JVT_cut");
     m_jet_cutflow_btag_cut        = m_jet_cutflowHist_1->GetXaxis()->FindBin("BTag_cut");
     m_jet_cutflow_cleaning_cut    = m_jet_cutflowHist_1->GetXaxis()->FindBin("cleaning_cut");
+    m_jet_cutflowCounter_1.setHistograms( m_jet_cutflowHist_1 );
 
   }
 
@@ -570,7 +571,7 @@ bool JetSelector :: executeSelection ( const xAOD::JetContainer* inJets,
       }// if jet is not clean
     }// if jet clean aux missing
     if( m_useCutFlow && passSel )
-      m_jet_cutflowHist_1->Fill( m_jet_cutflow_cleaning_cut, 1 );
+      m_jet_cutflowCounter_1.fill( m_jet_cutflow_cleaning_cut );
 
 
 
@@ -991,6 +992,7 @@ EL::StatusCode JetSelector :: finalize ()
     ANA_MSG_DEBUG( "Filling cutflow");
     m_cutflowHist ->SetBinContent( m_cutflow_bin, m_numEventPass        );
     m_cutflowHistW->SetBinContent( m_cutflow_bin, m_weightNumEventPass  );
+    m_jet_cutflowCounter_1.materialize();
   }
 
   return EL::StatusCode::SUCCESS;
@@ -1045,18 +1047,18 @@ int JetSelector :: PassCuts( const xAOD::Jet* jet ) {
   }
 
   // fill cutflow bin 'all' before any cut
-  if(m_useCutFlow) m_jet_cutflowHist_1->Fill( m_jet_cutflow_all, 1 );
+  if(m_useCutFlow) m_jet_cutflowCounter_1.fill( m_jet_cutflow_all );
 
   // pT
   if ( m_pT_max != 1e8 ) {
     if ( jetPt > m_pT_max ) { return 0; }
   }
-  if(m_useCutFlow) m_jet_cutflowHist_1->Fill( m_jet_cutflow_ptmax_cut, 1 );
+  if(m_useCutFlow) m_jet_cutflowCounter_1.fill( m_jet_cutflow_ptmax_cut );
 
   if ( m_pT_min != 1e8 ) {
     if ( jetPt < m_pT_min ) { return 0; }
   }
-  if(m_useCutFlow) m_jet_cutflowHist_1->Fill( m_jet_cutflow_ptmin_cut, 1 );
+  if(m_useCutFlow) m_jet_cutflowCounter_1.fill( m_jet_cutflow_ptmin_cut );
 
   // eta
   if ( m_eta_max != 1e8 ) {
@@ -1065,7 +1067,7 @@ int JetSelector :: PassCuts( const xAOD::Jet* jet ) {
   if ( m_eta_min != 1e8 ) {
     if ( fabs(jetEta) < m_eta_min ) { return 0; }
   }
-  if(m_useCutFlow) m_jet_cutflowHist_1->Fill( m_jet_cutflow_eta_cut, 1 );
+  if(m_useCutFlow) m_jet_cutflowCounter_1.fill( m_jet_cutflow_eta_cut );
 
   // detEta
   if ( m_detEta_max != 1e8 ) {
@@ -1143,7 +1145,7 @@ int JetSelector :: PassCuts( const xAOD::Jet* jet ) {
     else       ANA_MSG_DEBUG(" ... jet does not pass Jvt cut");
     if ( !m_noJVTVeto && !result ) return 0;
   }
-  if ( m_useCutFlow ) m_jet_cutflowHist_1->Fill( m_jet_cutflow_jvt_cut, 1 );
+  if ( m_useCutFlow ) m_jet_cutflowCounter_1.fill( m_jet_cutflow_jvt_cut );
 
   //
   //  BTagging
@@ -1151,7 +1153,7 @@ int JetSelector :: PassCuts( const xAOD::Jet* jet ) {
   if ( m_doBTagCut ) {
     ANA_MSG_DEBUG("Doing BTagging");
     if ( m_BJetSelectTool_handle->accept( jet ) ) {
-      if(m_useCutFlow) m_jet_cutflowHist_1->Fill( m_jet_cutflow_btag_cut, 1 );
+      if(m_useCutFlow) m_jet_cutflowCounter_1.fill( m_jet_cutflow_btag_cut );
     } else {
       return 0;
     }
@@ -54,6 +54,7 @@
 #include <xAODAnaHelpers/TauJetMatching.h>
 #include <xAODAnaHelpers/Writer.h>
 #include <xAODAnaHelpers/MessagePrinterAlgo.h>
+#include <xAODAnaHelpers/FileMetadataCache.h>
 
 #ifdef __CINT__
 
@@ -111,5 +112,6 @@
 #pragma link C++ class TauJetMatching+;
 #pragma link C++ class Writer+;
 #pragma link C++ class MessagePrinterAlgo+;
+#pragma link C++ class FileMetadataCache;
 
 #endif
@@ -2,6 +2,10 @@
 #include <iostream>
 #include <typeinfo>
 #include <sstream>
+#include <set>
+#include <thread>
+#include <algorithm>
+#include <fnmatch.h>
 
 // EL include(s):
 #include <EventLoop/Job.h>
@@ -11,6 +15,8 @@
 #include "EventLoop/OutputStream.h"
 
 // EDM include(s):
+#include "AthContainers/AuxTypeRegistry.h"
+#include "AthContainers/AuxVectorData.h"
 #include "xAODCore/AuxContainerBase.h"
 #include "xAODBase/IParticleContainer.h"
 #include "xAODCore/ShallowCopy.h"
@@ -37,6 +43,91 @@
 #include "xAODAnaHelpers/HelperClasses.h"
 #include "xAODAnaHelpers/HelperFunctions.h"
 
+// ROOT include(s):
+#include <TROOT.h>
+
+/// Deep-copies and records the containers of one xAOD type, resolved once instead of a dynamic_cast chain per key and event
+class MinixAODCopier
+{
+  public:
+    virtual ~MinixAODCopier() {}
+
+    /// deep-copy ``cont`` into new containers kept until ``recordCopy``; touches neither TStore nor TEvent, so it can run on any thread
+    virtual void copy(const xAOD::IParticleContainer* cont) = 0;
+    /// record the containers made by ``copy`` into the TStore
+    virtual StatusCode recordCopy(xAOD::TStore* store, const std::string& key) = 0;
+    /// record the container ``key`` and its aux container from the TStore into the TEvent
+    virtual StatusCode recordOutput(xAOD::TEvent* event, xAOD::TStore* store, const std::string& key) const = 0;
+
+    /// the copier for the type of ``cont``, nullptr if it is not a supported type
+    static std::shared_ptr<MinixAODCopier> make(const xAOD::IParticleContainer* cont);
+};
+
+namespace {
+
+  /// read all aux variables of the containers the elements of ``cont`` live in, as reading them lazily from the input is not thread-safe
+  void loadAuxData(const xAOD::IParticleContainer* cont)
+  {
+    std::set<const SG::AuxVectorData*> containers;
+    for(const xAOD::IParticle* p: *cont) containers.insert(p->container());
+    for(const SG::AuxVectorData* container: containers){
+      for(SG::auxid_t auxid: container->getAuxIDs()) container->getDataArray(auxid);
+    }
+  }
+
+  template <typename T1, typename T2, typename T3>
+  class TypedCopier : public MinixAODCopier
+  {
+    public:
+      void copy(const xAOD::IParticleContainer* cont)
+      {
+        m_cont.reset(new T1);
+        m_auxcont.reset(new T2);
+        m_cont->setStore(m_auxcont.get());
+
+        for(const auto p: *static_cast<const T1*>(cont)){
+          T3* p_new = new T3;
+          m_cont->push_back(p_new);
+          *p_new = *p;
+        }
+      }
+
+      StatusCode recordCopy(xAOD::TStore* store, const std::string& key)
+      {
+        if(!store->record(m_cont.release(), key).isSuccess()) return StatusCode::FAILURE;
+        if(!store->record(m_auxcont.release(), key+"Aux.").isSuccess()) return StatusCode::FAILURE;
+        return StatusCode::SUCCESS;
+      }
+
+      StatusCode recordOutput(xAOD::TEvent* event, xAOD::TStore* store, const std::string& key) const
+      {
+        return HelperFunctions::recordOutput<T1, T2>(event, store, key);
+      }
+
+    private:
+      std::unique_ptr<T1> m_cont;
+      std::unique_ptr<T2> m_auxcont;
+  };
+
+}
+
+std::shared_ptr<MinixAODCopier> MinixAODCopier::make(const xAOD::IParticleContainer* cont)
+{
+  if(dynamic_cast<const xAOD::ElectronContainer*>(cont))
+    return std::make_shared< TypedCopier<xAOD::ElectronContainer, xAOD::ElectronAuxContainer, xAOD::Electron> >();
+  if(dynamic_cast<const xAOD::JetContainer*>(cont))
+    return std::make_shared< TypedCopier<xAOD::JetContainer, xAOD::JetAuxContainer, xAOD::Jet> >();
+  if(dynamic_cast<const xAOD::MissingETContainer*>(cont))
+    return std::make_shared< TypedCopier<xAOD::MissingETContainer, xAOD::MissingETAuxContainer, xAOD::MissingET> >();
+  if(dynamic_cast<const xAOD::MuonContainer*>(cont))
+    return std::make_shared< TypedCopier<xAOD::MuonContainer, xAOD::MuonAuxContainer, xAOD::Muon> >();
+  if(dynamic_cast<const xAOD::PhotonContainer*>(cont))
+    return std::make_shared< TypedCopier<xAOD::PhotonContainer, xAOD::PhotonAuxContainer, xAOD::Photon> >();
+  if(dynamic_cast<const xAOD::TauJetContainer*>(cont))
+    return std::make_shared< TypedCopier<xAOD::TauJetContainer, xAOD::TauJetAuxContainer, xAOD::TauJet> >();
+  return nullptr;
+}
+
 // this is needed to distribute the algorithm to the workers
 ClassImp(MinixAOD)
 
@@ -175,6 +266,27 @@ EL::StatusCode MinixAOD :: initialize ()
     m_vectorCopyKeys_vec.push_back(std::pair<std::string, std::string>(token.substr(0, pos), token.substr(pos+1)));
   }
 
+  // A1|a.b.c B1|-d.-e ... -> {A1: [a, b, c], B1: [-d, -e], ...}
+  ss.clear(); ss.str(m_auxItems);
+  while(std::getline(ss, token, ' ')){
+    if(token.empty()) continue;
+    int pos = token.find_first_of('|');
+    std::vector<std::string>& items = m_auxItems_map[token.substr(0, pos)];
+    std::string item;
+    std::istringstream itemss(token.substr(pos+1));
+    while(std::getline(itemss, item, '.'))
+      if(!item.empty()) items.push_back(item);
+  }
+
+  m_deepCopiers.assign(m_deepCopyKeys_vec.size(), nullptr);
+  m_outputCopiers.clear();
+
+  if(m_deepCopyThreads > 1) ROOT::EnableThreadSafety();
+  if(m_compressionThreads > 0){
+    ANA_MSG_INFO("Compressing the output with " << m_compressionThreads << " threads");
+    ROOT::EnableImplicitMT(m_compressionThreads);
+  }
+
   ANA_MSG_DEBUG("MinixAOD Interface succesfully initialized!" );
 
   return EL::StatusCode::SUCCESS;
@@ -205,34 +317,51 @@ EL::StatusCode MinixAOD :: execute ()
 
   // simple copy is easiest - it's in the input, copy over, no need for types
   for(const auto& key: m_simpleCopyKeys_vec){
+    ANA_CHECK( setAuxItems(key));
     ANA_CHECK( m_event->copy(key));
     ANA_MSG_DEBUG("Copying " << key << " from input file");
   }
 
   // we need to make deep copies
-  for(const auto& keypair: m_deepCopyKeys_vec){
-    auto in_key = keypair.first;
-    auto out_key = keypair.second;
+  std::vector<const xAOD::IParticleContainer*> deepCopyInputs;
+  for(unsigned int iKey = 0; iKey < m_deepCopyKeys_vec.size(); ++iKey){
+    const std::string& in_key = m_deepCopyKeys_vec[iKey].first;
 
     const xAOD::IParticleContainer* cont(nullptr);
     ANA_CHECK( HelperFunctions::retrieve(cont, in_key, nullptr, m_store, msg()));
 
-    if(const xAOD::ElectronContainer* t_cont = dynamic_cast<const xAOD::ElectronContainer*>(cont)){
-      ANA_CHECK( (HelperFunctions::makeDeepCopy<xAOD::ElectronContainer, xAOD::ElectronAuxContainer, xAOD::Electron>(m_store, out_key.c_str(), t_cont)));
-    } else if(const xAOD::JetContainer* t_cont = dynamic_cast<const xAOD::JetContainer*>(cont)){
-      ANA_CHECK( (HelperFunctions::makeDeepCopy<xAOD::JetContainer, xAOD::JetAuxContainer, xAOD::Jet>(m_store, out_key.c_str(), t_cont)));
-    } else if(const xAOD::MissingETContainer* t_cont = dynamic_cast<const xAOD::MissingETContainer*>(cont)){
-      ANA_CHECK( (HelperFunctions::makeDeepCopy<xAOD::MissingETContainer, xAOD::MissingETAuxContainer, xAOD::MissingET>(m_store, out_key.c_str(), t_cont)));
-    } else if(const xAOD::MuonContainer* t_cont = dynamic_cast<const xAOD::MuonContainer*>(cont)){
-      ANA_CHECK( (HelperFunctions::makeDeepCopy<xAOD::MuonContainer, xAOD::MuonAuxContainer, xAOD::Muon>(m_store, out_key.c_str(), t_cont)));
-    } else if(const xAOD::PhotonContainer* t_cont = dynamic_cast<const xAOD::PhotonContainer*>(cont)){
-      ANA_CHECK( (HelperFunctions::makeDeepCopy<xAOD::PhotonContainer, xAOD::PhotonAuxContainer, xAOD::Photon>(m_store, out_key.c_str(), t_cont)));
-    } else if(const xAOD::TauJetContainer* t_cont = dynamic_cast<const xAOD::TauJetContainer*>(cont)){
-      ANA_CHECK( (HelperFunctions::makeDeepCopy<xAOD::TauJetContainer, xAOD::TauJetAuxContainer, xAOD::TauJet>(m_store, out_key.c_str(), t_cont)));
-    } else {
+    if(!m_deepCopiers[iKey]) m_deepCopiers[iKey] = MinixAODCopier::make(cont);
+    if(!m_deepCopiers[iKey]){
       ANA_MSG_ERROR("Could not identify what container " << in_key << " corresponds to for deep-copying.");
       return EL::StatusCode::FAILURE;
     }
+    deepCopyInputs.push_back(cont);
+  }
+
+  // the copies only touch their own new containers, so independent keys are copied in parallel
+  // once everything they read is in memory; views and shallow copies read their parent's variables
+  unsigned int nThreads = std::min<size_t>(m_deepCopyThreads, deepCopyInputs.size());
+  if(nThreads > 1){
+    for(const auto cont: deepCopyInputs) loadAuxData(cont);
+
+    std::vector<std::thread> threads;
+    for(unsigned int iThread = 0; iThread < nThreads; ++iThread){
+      threads.emplace_back( [this, &deepCopyInputs, iThread, nThreads]() {
+        for(size_t iKey = iThread; iKey < deepCopyInputs.size(); iKey += nThreads)
+          m_deepCopiers[iKey]->copy(deepCopyInputs[iKey]);
+      } );
+    }
+    for(auto& thread: threads) thread.join();
+  } else {
+    for(size_t iKey = 0; iKey < deepCopyInputs.size(); ++iKey)
+      m_deepCopiers[iKey]->copy(deepCopyInputs[iKey]);
+  }
+
+  for(unsigned int iKey = 0; iKey < m_deepCopyKeys_vec.size(); ++iKey){
+    const std::string& in_key = m_deepCopyKeys_vec[iKey].first;
+    const std::string& out_key = m_deepCopyKeys_vec[iKey].second;
+
+    ANA_CHECK( m_deepCopiers[iKey]->recordCopy(m_store, out_key));
     m_copyFromStoreToEventKeys_vec.push_back(out_key);
 
     ANA_MSG_DEBUG("Deep-Copied " << in_key << " to " << out_key << " to record to output file");
@@ -281,26 +410,21 @@ EL::StatusCode MinixAOD :: execute ()
 
   // all we need to do is retrieve it and figure out what type it is to record it and we're done
   for(const auto& key: m_copyFromStoreToEventKeys_vec){
-    const xAOD::IParticleContainer* cont(nullptr);
-    ANA_CHECK( HelperFunctions::retrieve(cont, key, nullptr, m_store, msg()));
-
-    if(dynamic_cast<const xAOD::ElectronContainer*>(cont)){
-      ANA_CHECK( (HelperFunctions::recordOutput<xAOD::ElectronContainer, xAOD::ElectronAuxContainer>(m_event, m_store, key)));
-    } else if(dynamic_cast<const xAOD::JetContainer*>(cont)){
-      ANA_CHECK( (HelperFunctions::recordOutput<xAOD::JetContainer, xAOD::JetAuxContainer>(m_event, m_store, key)));
-    } else if(dynamic_cast<const xAOD::MissingETContainer*>(cont)){
-      ANA_CHECK( (HelperFunctions::recordOutput<xAOD::MissingETContainer, xAOD::MissingETAuxContainer>(m_event, m_store, key)));
-    } else if(dynamic_cast<const xAOD::MuonContainer*>(cont)){
-      ANA_CHECK( (HelperFunctions::recordOutput<xAOD::MuonContainer, xAOD::MuonAuxContainer>(m_event, m_store, key)));
-    } else if(dynamic_cast<const xAOD::PhotonContainer*>(cont)){
-      ANA_CHECK( (HelperFunctions::recordOutput<xAOD::PhotonContainer, xAOD::PhotonAuxContainer>(m_event, m_store, key)));
-    } else if(dynamic_cast<const xAOD::TauJetContainer*>(cont)){
-      ANA_CHECK( (HelperFunctions::recordOutput<xAOD::TauJetContainer, xAOD::TauJetAuxContainer>(m_event, m_store, key)));
-    } else {
-      ANA_MSG_ERROR("Could not identify what container " << key << " corresponds to for copying from TStore to TEvent.");
-      return EL::StatusCode::FAILURE;
+    std::shared_ptr<MinixAODCopier>& copier = m_outputCopiers[key];
+    if(!copier){
+      const xAOD::IParticleContainer* cont(nullptr);
+      ANA_CHECK( HelperFunctions::retrieve(cont, key, nullptr, m_store, msg()));
+
+      copier = MinixAODCopier::make(cont);
+      if(!copier){
+        ANA_MSG_ERROR("Could not identify what container " << key << " corresponds to for copying from TStore to TEvent.");
+        return EL::StatusCode::FAILURE;
+      }
     }
 
+    ANA_CHECK( setAuxItems(key));
+    ANA_CHECK( copier->recordOutput(m_event, m_store, key));
+
     ANA_MSG_DEBUG("Copied " << key << " and it's auxiliary container from TStore to TEvent");
   }
 
@@ -312,6 +436,53 @@ EL::StatusCode MinixAOD :: execute ()
 
 }
 
+EL::StatusCode MinixAOD :: setAuxItems(const std::string& key)
+{
+  auto found = m_auxItems_map.find(key);
+  if(found == m_auxItems_map.end()) return EL::StatusCode::SUCCESS;
+  const std::vector<std::string>& patterns = found->second;
+
+  bool hasWildcards = std::any_of(patterns.begin(), patterns.end(), [](const std::string& pattern){ return pattern.find_first_of("*?") != std::string::npos; });
+  bool onlyExcludes = std::all_of(patterns.begin(), patterns.end(), [](const std::string& pattern){ return pattern[0] == '-'; });
+
+  std::string itemList;
+  if(!hasWildcards){
+    // TEvent understands plain names and "-name" exclusions as they are
+    for(const auto& pattern: patterns) itemList += (itemList.empty() ? "" : ".") + pattern;
+  } else {
+    // match against every variable known to the process, which also works before the container has any
+    SG::AuxTypeRegistry& registry = SG::AuxTypeRegistry::instance();
+    for(SG::auxid_t auxid = 0; auxid < registry.numVariables(); ++auxid){
+      const std::string name = registry.getName(auxid);
+      bool keep(onlyExcludes);
+      for(const auto& pattern: patterns){
+        bool exclude = (pattern[0] == '-');
+        if(fnmatch(pattern.c_str() + (exclude ? 1 : 0), name.c_str(), 0) == 0) keep = !exclude;
+      }
+      // a list of exclusions only stays one, so variables created later are still written
+      if(onlyExcludes && !keep) itemList += (itemList.empty() ? "-" : ".-") + name;
+      if(!onlyExcludes && keep) itemList += (itemList.empty() ? "" : ".") + name;
+    }
+
+    if(itemList.empty() && !onlyExcludes){
+      ANA_MSG_ERROR("None of the aux variables known for " << key << " pass the selection of m_auxItems.");
+      return EL::StatusCode::FAILURE;
+    }
+    ANA_MSG_WARNING("The wildcards in the aux items of " << key << " are resolved once, before its first write: aux variables created later are not matched by them.");
+  }
+
+  m_auxItems_map.erase(found);
+  if(itemList.empty()){
+    ANA_MSG_INFO("No aux variables of " << key << " are excluded by m_auxItems, writing all of them");
+    return EL::StatusCode::SUCCESS;
+  }
+
+  ANA_MSG_INFO("Writing the aux variables " << itemList << " of " << key);
+  m_event->setAuxItemList(key+"Aux.", itemList);
+
+  return EL::StatusCode::SUCCESS;
+}
+
 EL::StatusCode MinixAOD :: postExecute () { return EL::StatusCode::SUCCESS; }
 
 EL::StatusCode MinixAOD :: finalize () {
@@ -215,6 +215,7 @@ void MuonContainer::setTree(TTree *tree)
   //
   // Connect branches
   ParticleContainer::setTree(tree);
+  if ( m_lazy ) return;
 
   if ( m_infoSwitch.m_kinematic ) {
     connectBranch<float>(tree, "charge", &m_charge);
@@ -226,6 +227,10 @@ void MuonContainer::setTree(TTree *tree)
     connectBranch<string>      (tree, "listTrigChains",       &m_listTrigChains );
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    connectTrigMatchMaskBranch(tree);
+  }
+
   if ( m_infoSwitch.m_isolation ) {
     for (auto& isol : m_infoSwitch.m_isolWPs) {
       if (!isol.empty()) {
@@ -247,7 +252,23 @@ void MuonContainer::setTree(TTree *tree)
     connectBranch<float>(tree,"topoetcone40",   &m_topoetcone40);
   }
 
-  if ( m_infoSwitch.m_effSF && m_mc ) {
+  if ( m_infoSwitch.m_effSF && m_mc && m_infoSwitch.m_effSFFlat ) {
+    for (auto& reco : m_infoSwitch.m_recoWPs) {
+      connectFlatSFBranch(tree, "RecoEff_SF_Reco" + reco);
+
+      for (auto& trig : m_infoSwitch.m_trigWPs) {
+        connectFlatSFBranch(tree, "TrigEff_SF_" + trig + "_Reco" + reco);
+        connectFlatSFBranch(tree, "TrigMCEff_"  + trig + "_Reco" + reco);
+      }
+    }
+
+    for (auto& isol : m_infoSwitch.m_isolWPs) {
+      connectFlatSFBranch(tree, "IsoEff_SF_Iso" + isol);
+    }
+
+    connectFlatSFBranch(tree, "TTVAEff_SF");
+  }
+  else if ( m_infoSwitch.m_effSF && m_mc ) {
     for (auto& reco : m_infoSwitch.m_recoWPs) {
       tree->SetBranchStatus ( (m_name + "_RecoEff_SF_Reco" + reco).c_str() , 1);
       tree->SetBranchAddress( (m_name + "_RecoEff_SF_Reco" + reco).c_str() , & (*m_RecoEff_SF)[ reco ] );
@@ -346,6 +367,10 @@ void MuonContainer::updateParticle(uint idx, Muon& muon)
     muon.isTrigMatchedToChain  =     m_isTrigMatchedToChain  ->at(idx);
     muon.listTrigChains        =     m_listTrigChains        ->at(idx);
   }
+
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    muon.trigMatchMask         =     m_trigMatchMask         ->at(idx);
+  }
     
   // isolation
   if ( m_infoSwitch.m_isolation ) {
@@ -379,7 +404,26 @@ void MuonContainer::updateParticle(uint idx, Muon& muon)
   
   // scale factors w/ sys
   // per object
-  if ( m_infoSwitch.m_effSF && m_mc ) {
+  if ( m_infoSwitch.m_effSF && m_mc && m_infoSwitch.m_effSFFlat ) {
+
+    // in the order of connectFlatSFBranch in setTree
+    unsigned int iSF = 0;
+    for (auto& reco : m_infoSwitch.m_recoWPs) {
+      muon.RecoEff_SF[ reco ] = flatSF(*m_flatSFOrder[iSF++], idx);
+
+      for (auto& trig : m_infoSwitch.m_trigWPs) {
+        muon.TrigEff_SF[ trig+reco ] = flatSF(*m_flatSFOrder[iSF++], idx);
+        muon.TrigMCEff [ trig+reco ] = flatSF(*m_flatSFOrder[iSF++], idx);
+      }
+    }
+
+    for (auto& isol : m_infoSwitch.m_isolWPs) {
+      muon.IsoEff_SF[ isol ] = flatSF(*m_flatSFOrder[iSF++], idx);
+    }
+
+    muon.TTVAEff_SF = flatSF(*m_flatSFOrder[iSF++], idx);
+  }
+  else if ( m_infoSwitch.m_effSF && m_mc ) {
     
     for (auto& reco : m_infoSwitch.m_recoWPs) {
       muon.RecoEff_SF[ reco ] = (*m_RecoEff_SF)[ reco ].at(idx);
@@ -470,6 +514,11 @@ void MuonContainer::setBranches(TTree *tree)
     setBranch<string>(tree, "listTrigChains", m_listTrigChains );
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    // one bit per chain, the chain names are stored once in the tree UserInfo
+    setTrigMatchMaskBranch(tree);
+  }
+
   if ( m_infoSwitch.m_isolation ) {
     for (auto& isol : m_infoSwitch.m_isolWPs) {
       if (!isol.empty()) {
@@ -490,7 +539,25 @@ void MuonContainer::setBranches(TTree *tree)
     setBranch<float>(tree,"topoetcone40",   m_topoetcone40);
   }
 
-  if ( m_infoSwitch.m_effSF && m_mc ) {
+  if ( m_infoSwitch.m_effSF && m_mc && m_infoSwitch.m_effSFFlat ) {
+
+    for (auto& reco : m_infoSwitch.m_recoWPs) {
+      setFlatSFBranch(tree, "RecoEff_SF_Reco" + reco);
+
+      for (auto& trig : m_infoSwitch.m_trigWPs) {
+        setFlatSFBranch(tree, "TrigEff_SF_" + trig + "_Reco" + reco);
+        setFlatSFBranch(tree, "TrigMCEff_"  + trig + "_Reco" + reco);
+      }
+    }
+
+    for (auto& isol : m_infoSwitch.m_isolWPs) {
+      setFlatSFBranch(tree, "IsoEff_SF_Iso" + isol);
+    }
+
+    setFlatSFBranch(tree, "TTVAEff_SF");
+
+  }
+  else if ( m_infoSwitch.m_effSF && m_mc ) {
     
     for (auto& reco : m_infoSwitch.m_recoWPs) {
       tree->Branch( (m_name + "_RecoEff_SF_Reco" + reco).c_str() , & (*m_RecoEff_SF)[ reco ] );
@@ -587,6 +654,10 @@ void MuonContainer::clear()
     m_listTrigChains->clear();
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    m_trigMatchMask->clear();
+  }
+
   if ( m_infoSwitch.m_isolation ) {
     for (auto& isol : m_infoSwitch.m_isolWPs) {
       (*m_isIsolated)[ isol ].clear();
@@ -650,7 +721,10 @@ void MuonContainer::clear()
     m_PromptLeptonVeto                   -> clear();
   }
 
-  if ( m_infoSwitch.m_effSF && m_mc ) {
+  if ( m_infoSwitch.m_effSF && m_mc && m_infoSwitch.m_effSFFlat ) {
+    clearFlatSFs();
+  }
+  else if ( m_infoSwitch.m_effSF && m_mc ) {
     
     for (auto& reco : m_infoSwitch.m_recoWPs) {
       (*m_RecoEff_SF)[ reco ].clear();
@@ -698,6 +772,11 @@ void MuonContainer::FillMuon( const xAOD::IParticle* particle, const xAOD::Verte
     m_charge->push_back( muon->charge() );
   }
 
+  if ( m_infoSwitch.m_trigMatchMask ) {
+    static SG::AuxElement::ConstAccessor< std::map<std::string,char> > acc_isTrigMatchedMap("isTrigMatchedMapMu");
+    fillTrigMatchMask( acc_isTrigMatchedMap.isAvailable( *muon ) ? &acc_isTrigMatchedMap( *muon ) : nullptr );
+  }
+
   if ( m_infoSwitch.m_trigger ) {
 
     // retrieve map<string,char> w/ <chain,isMatched>
@@ -864,22 +943,28 @@ void MuonContainer::FillMuon( const xAOD::IParticle* particle, const xAOD::Verte
     std::vector<float> junkSF(1,-1.0);
     std::vector<float> junkEff(1,-1.0);
 
+    // in the order of setFlatSFBranch in setBranches
+    unsigned int iSF = 0;
+
     static std::map< std::string, SG::AuxElement::Accessor< std::vector< float > > > accRecoSF;
     static std::map< std::string, SG::AuxElement::Accessor< std::vector< float > > > accTrigSF;
     static std::map< std::string, SG::AuxElement::Accessor< std::vector< float > > > accTrigEFF;
     for (auto& reco : m_infoSwitch.m_recoWPs) {
       std::string recoEffSF = "MuRecoEff_SF_syst_Reco" + reco;
       accRecoSF.insert( std::pair<std::string, SG::AuxElement::Accessor< std::vector< float > > > ( reco , SG::AuxElement::Accessor< std::vector< float > >( recoEffSF ) ) );
-      safeSFVecFill<float, xAOD::Muon>( muon, accRecoSF.at( reco ), &m_RecoEff_SF->at( reco ), junkSF );
+      if ( m_infoSwitch.m_effSFFlat ) fillFlatSF( muon, accRecoSF.at( reco ), *m_flatSFOrder[iSF++], m_infoSwitch.m_effSFQuant );
+      else safeSFVecFill<float, xAOD::Muon>( muon, accRecoSF.at( reco ), &m_RecoEff_SF->at( reco ), junkSF );
 
       for (auto& trig : m_infoSwitch.m_trigWPs) {
         std::string trigEffSF = "MuTrigEff_SF_syst_" + trig + "_Reco" + reco;
         accTrigSF.insert( std::pair<std::string, SG::AuxElement::Accessor< std::vector< float > > > ( trig+reco , SG::AuxElement::Accessor< std::vector< float > >( trigEffSF ) ) );
-        safeSFVecFill<float, xAOD::Muon>( muon, accTrigSF.at( trig+reco ), &m_TrigEff_SF->at( trig+reco ), junkSF );
+        if ( m_infoSwitch.m_effSFFlat ) fillFlatSF( muon, accTrigSF.at( trig+reco ), *m_flatSFOrder[iSF++], m_infoSwitch.m_effSFQuant );
+        else safeSFVecFill<float, xAOD::Muon>( muon, accTrigSF.at( trig+reco ), &m_TrigEff_SF->at( trig+reco ), junkSF );
 
         std::string trigMCEff = "MuTrigMCEff_syst_" + trig + "_Reco" + reco;
         accTrigEFF.insert( std::pair<std::string, SG::AuxElement::Accessor< std::vector< float > > > ( trig+reco , SG::AuxElement::Accessor< std::vector< float > >( trigMCEff ) ) );
-        safeSFVecFill<float, xAOD::Muon>( muon, accTrigEFF.at( trig+reco ), &m_TrigMCEff->at( trig+reco ), junkEff );
+        if ( m_infoSwitch.m_effSFFlat ) fillFlatSF( muon, accTrigEFF.at( trig+reco ), *m_flatSFOrder[iSF++], m_infoSwitch.m_effSFQuant );
+        else safeSFVecFill<float, xAOD::Muon>( muon, accTrigEFF.at( trig+reco ), &m_TrigMCEff->at( trig+reco ), junkEff );
       }
     }
 
@@ -887,11 +972,13 @@ void MuonContainer::FillMuon( const xAOD::IParticle* particle, const xAOD::Verte
     for (auto& isol : m_infoSwitch.m_isolWPs) {
       std::string isolEffSF = "MuIsoEff_SF_syst_Iso" + isol;
       accIsoSF.insert( std::pair<std::string, SG::AuxElement::Accessor< std::vector< float > > > ( isol , SG::AuxElement::Accessor< std::vector< float > >( isolEffSF ) ) );
-      safeSFVecFill<float, xAOD::Muon>( muon, accIsoSF.at( isol ), &m_IsoEff_SF->at( isol ), junkSF );
+      if ( m_infoSwitch.m_effSFFlat ) fillFlatSF( muon, accIsoSF.at( isol ), *m_flatSFOrder[iSF++], m_infoSwitch.m_effSFQuant );
+      else safeSFVecFill<float, xAOD::Muon>( muon, accIsoSF.at( isol ), &m_IsoEff_SF->at( isol ), junkSF );
     }
 
     static SG::AuxElement::Accessor< std::vector< float > > accTTVASF("MuTTVAEff_SF_syst_TTVA");
-    safeSFVecFill<float, xAOD::Muon>( muon, accTTVASF, m_TTVAEff_SF, junkSF );
+    if ( m_infoSwitch.m_effSFFlat ) fillFlatSF( muon, accTTVASF, *m_flatSFOrder[iSF++], m_infoSwitch.m_effSFQuant );
+    else safeSFVecFill<float, xAOD::Muon>( muon, accTTVASF, m_TTVAEff_SF, junkSF );
 
   }
 
@@ -156,6 +156,7 @@ EL::StatusCode MuonSelector :: initialize ()
     m_mu_cutflow_iso_cut              = m_mu_cutflowHist_1->GetXaxis()->FindBin("iso_cut");
     if( m_removeCosmicMuon )
       m_mu_cutflow_cosmic_cut              = m_mu_cutflowHist_1->GetXaxis()->FindBin("cosmic_cut");
+    m_mu_cutflowCounter_1.setHistograms( m_mu_cutflowHist_1 );
 
 
     if ( m_isUsedBefore ) {
@@ -172,6 +173,7 @@ EL::StatusCode MuonSelector :: initialize ()
       m_mu_cutflow_iso_cut		 = m_mu_cutflowHist_2->GetXaxis()->FindBin("iso_cut");
       if( m_removeCosmicMuon )
         m_mu_cutflow_cosmic_cut		 = m_mu_cutflowHist_2->GetXaxis()->FindBin("cosmic_cut");
+      m_mu_cutflowCounter_2.setHistograms( m_mu_cutflowHist_2 );
     }
 
   }// if m_useCutFlow
@@ -716,6 +718,8 @@ EL::StatusCode MuonSelector :: finalize ()
     ANA_MSG_INFO( "Filling cutflow");
     m_cutflowHist ->SetBinContent( m_cutflow_bin, m_numEventPass        );
     m_cutflowHistW->SetBinContent( m_cutflow_bin, m_weightNumEventPass  );
+    m_mu_cutflowCounter_1.materialize();
+    m_mu_cutflowCounter_2.materialize();
   }
 
   return EL::StatusCode::SUCCESS;
@@ -745,8 +749,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
 
   ANA_MSG_DEBUG( "In  passCuts..." );
   // fill cutflow bin 'all' before any cut
-  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_all, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_all, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_all );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_all ); }
   ANA_MSG_DEBUG( "In  passCuts2..." );
   // *********************************************************************************************************************************************************************
   //
@@ -774,8 +778,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
     return 0;
   }
 
-  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_eta_and_quaility_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_eta_and_quaility_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_eta_and_quaility_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_eta_and_quaility_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -788,8 +792,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
       return 0;
     }
   }
-  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_ptmax_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_ptmax_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_ptmax_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_ptmax_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -801,8 +805,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
       return 0;
     }
   }
-  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_ptmin_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_ptmin_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_ptmin_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_ptmin_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -856,8 +860,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
       ANA_MSG_DEBUG( "Muon failed z0*sin(theta) cut.");
       return 0;
   }
-  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_z0sintheta_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_z0sintheta_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_z0sintheta_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_z0sintheta_cut ); }
 
   // decorate muon w/ z0*sin(theta) info
   static SG::AuxElement::Decorator< float > z0sinthetaDecor("z0sintheta");
@@ -869,8 +873,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
       ANA_MSG_DEBUG( "Muon failed d0 cut.");
       return 0;
   }
-  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_d0_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_d0_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_d0_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_d0_cut ); }
 
   // d0sig cut
   //
@@ -878,8 +882,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
       ANA_MSG_DEBUG( "Muon failed d0 significance cut.");
       return 0;
   }
-  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_d0sig_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_d0sig_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_d0sig_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_d0sig_cut ); }
 
   // decorate muon w/ d0sig info
   static SG::AuxElement::Decorator< float > d0SigDecor("d0sig");
@@ -912,8 +916,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
     ANA_MSG_DEBUG( "Muon failed isolation cut " <<  m_MinIsoWPCut );
     return 0;
   }
-  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_iso_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_iso_cut, 1 ); }
+  if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_iso_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_iso_cut ); }
 
   if( m_removeCosmicMuon ){
 
@@ -925,8 +929,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
       ANA_MSG_DEBUG("Muon failed cosmic cut" );
       return 0;
     }
-    if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_cosmic_cut, 1 );
-    if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_cosmic_cut, 1 ); }
+    if (!m_isUsedBefore && m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_cosmic_cut );
+    if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_cosmic_cut ); }
 
   }
 
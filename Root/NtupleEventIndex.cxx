@@ -0,0 +1,192 @@
+/******************************************
+ *
+ * Sorted (runNumber, eventNumber) -> (tree, entry)
+ * index written next to the TreeAlgo trees.
+ *
+ ******************************************/
+
+#include "xAODAnaHelpers/NtupleEventIndex.h"
+
+// ROOT include(s):
+#include <TList.h>
+#include <TObjString.h>
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+NtupleEventIndex::NtupleEventIndex() :
+  m_sorted(true)
+{
+}
+
+void NtupleEventIndex::add(const std::string& treeName, UInt_t run, ULong64_t event, Long64_t entry) {
+  int id = addTree(treeName);
+
+  Entry newEntry = { run, static_cast<UShort_t>(id), event, entry };
+  if( !m_entries.empty() && lessThan(newEntry, m_entries.back()) ) m_sorted = false;
+  m_entries.push_back(newEntry);
+}
+
+void NtupleEventIndex::write(TDirectory* dir) {
+  if( !m_sorted ) {
+    std::sort(m_entries.begin(), m_entries.end(), lessThan);
+    m_sorted = true;
+  }
+
+  TDirectory* currentDir = gDirectory;
+  dir->cd();
+
+  TTree* index = new TTree(treeName(), "runNumber, eventNumber -> tree, entry");
+  Entry entry;
+  index->Branch("runNumber",   &entry.run,   "runNumber/i");
+  index->Branch("eventNumber", &entry.event, "eventNumber/l");
+  index->Branch("tree",        &entry.tree,  "tree/s");
+  index->Branch("entry",       &entry.entry, "entry/L");
+  for( const Entry& e : m_entries ) {
+    entry = e;
+    index->Fill();
+  }
+
+  TList* trees = new TList();
+  trees->SetName("trees");
+  trees->SetOwner(kTRUE);
+  for( const auto& name : m_trees ) trees->Add( new TObjString(name.c_str()) );
+  index->GetUserInfo()->Add(trees);
+
+  index->Write("", TObject::kOverwrite);
+  delete index; // written now, so that closing the file does not write it again
+
+  // the sizes of this job's trees, to re-base the entries after merging
+  Long64_t nIndex = m_entries.size();
+  std::vector<std::string> treeNames(m_trees);
+  std::vector<Long64_t>    treeEntries(m_trees.size(), 0);
+  for( const Entry& e : m_entries ) treeEntries[e.tree] = std::max(treeEntries[e.tree], e.entry+1);
+  for( size_t id = 0; id < m_trees.size(); id++ ) {
+    TTree* tree = dynamic_cast<TTree*>(dir->Get(m_trees[id].c_str()));
+    if( tree ) treeEntries[id] = tree->GetEntries();
+  }
+  std::vector<std::string>* treeNamesPtr   = &treeNames;
+  std::vector<Long64_t>*    treeEntriesPtr = &treeEntries;
+
+  TTree* blocks = new TTree(blocksTreeName(), "index entries and tree sizes of each job");
+  blocks->Branch("nIndex",      &nIndex, "nIndex/L");
+  blocks->Branch("trees",       &treeNamesPtr);
+  blocks->Branch("treeEntries", &treeEntriesPtr);
+  blocks->Fill();
+  blocks->Write("", TObject::kOverwrite);
+  delete blocks;
+
+  currentDir->cd();
+}
+
+bool NtupleEventIndex::read(TDirectory* dir) {
+  m_trees.clear();
+  m_entries.clear();
+  m_sorted = true;
+
+  TTree* index = dir ? dynamic_cast<TTree*>(dir->Get(treeName())) : nullptr;
+  if( !index ) return false;
+
+  TList* trees = dynamic_cast<TList*>(index->GetUserInfo()->FindObject("trees"));
+  if( !trees ) return false;
+  for( const TObject* name : *trees ) m_trees.push_back( name->GetName() );
+
+  Entry entry;
+  index->SetBranchAddress("runNumber",   &entry.run);
+  index->SetBranchAddress("eventNumber", &entry.event);
+  index->SetBranchAddress("tree",        &entry.tree);
+  index->SetBranchAddress("entry",       &entry.entry);
+
+  m_entries.reserve(index->GetEntries());
+
+  TTree* blocks = dynamic_cast<TTree*>(dir->Get(blocksTreeName()));
+  if( !blocks ) {
+    // written before the blocks were, valid only if the file was not merged
+    for( Long64_t i = 0; i < index->GetEntries(); i++ ) {
+      index->GetEntry(i);
+      m_entries.push_back(entry);
+    }
+    index->ResetBranchAddresses();
+    return true;
+  }
+
+  // the index entries of each merged job, in the order of the jobs
+  Long64_t nIndex(0);
+  std::vector<std::string>* treeNames(nullptr);
+  std::vector<Long64_t>*    treeEntries(nullptr);
+  blocks->SetBranchAddress("nIndex",      &nIndex);
+  blocks->SetBranchAddress("trees",       &treeNames);
+  blocks->SetBranchAddress("treeEntries", &treeEntries);
+
+  m_trees.clear();
+  std::map<std::string, Long64_t> offsets;
+  Long64_t i(0);
+  for( Long64_t block = 0; block < blocks->GetEntries(); block++ ) {
+    blocks->GetEntry(block);
+
+    // tree ids of the job -> ids of the merged index
+    std::vector<UShort_t> ids;
+    for( const auto& name : *treeNames ) ids.push_back( addTree(name) );
+
+    for( Long64_t end = i + nIndex; i < end && i < index->GetEntries(); i++ ) {
+      index->GetEntry(i);
+      if( entry.tree >= ids.size() ) continue;
+      entry.entry += offsets[(*treeNames)[entry.tree]];
+      entry.tree   = ids[entry.tree];
+      m_entries.push_back(entry);
+    }
+
+    for( size_t id = 0; id < treeNames->size(); id++ ) offsets[(*treeNames)[id]] += treeEntries->at(id);
+  }
+  index->ResetBranchAddresses();
+  blocks->ResetBranchAddresses();
+  delete treeNames;
+  delete treeEntries;
+
+  if( i != index->GetEntries() ) {
+    // the index and the blocks were not merged the same way
+    m_trees.clear();
+    m_entries.clear();
+    return false;
+  }
+
+  // the entries of the jobs overlap in run and event number
+  if( blocks->GetEntries() > 1 ) std::sort(m_entries.begin(), m_entries.end(), lessThan);
+
+  return true;
+}
+
+Long64_t NtupleEventIndex::entry(const std::string& treeName, UInt_t run, ULong64_t event) const {
+  int id = treeId(treeName);
+  if( id < 0 || !m_sorted ) return -1;
+
+  Entry key = { run, static_cast<UShort_t>(id), event, 0 };
+  auto found = std::lower_bound(m_entries.begin(), m_entries.end(), key, lessThan);
+  if( found == m_entries.end() || found->run != run || found->event != event || found->tree != id ) return -1;
+  return found->entry;
+}
+
+Long64_t NtupleEventIndex::load(TTree* tree, UInt_t run, ULong64_t event) const {
+  Long64_t treeEntry = entry(tree->GetName(), run, event);
+  if( treeEntry < 0 || tree->GetEntry(treeEntry) <= 0 ) return -1;
+  return treeEntry;
+}
+
+bool NtupleEventIndex::lessThan(const Entry& a, const Entry& b) {
+  return std::tie(a.run, a.event, a.tree) < std::tie(b.run, b.event, b.tree);
+}
+
+int NtupleEventIndex::addTree(const std::string& treeName) {
+  int id = treeId(treeName);
+  if( id < 0 ) {
+    id = m_trees.size();
+    m_trees.push_back(treeName);
+  }
+  return id;
+}
+
+int NtupleEventIndex::treeId(const std::string& treeName) const {
+  auto found = std::find(m_trees.begin(), m_trees.end(), treeName);
+  return (found == m_trees.end()) ? -1 : found - m_trees.begin();
+}
@@ -0,0 +1,110 @@
+/******************************************
+ *
+ * Runs histogram workers over ntuple entries
+ * in parallel and merges their histograms.
+ *
+ ******************************************/
+
+#include <AsgTools/MsgStream.h>
+#include <AsgTools/MessageCheck.h>
+
+#include "xAODAnaHelpers/NtupleHistsDriver.h"
+
+// ROOT include(s):
+#include <TROOT.h>
+#include <TChain.h>
+#include <TH1.h>
+
+#include <thread>
+#include <algorithm>
+
+NtupleHistsDriver::NtupleHistsDriver(const std::string& treeName, const std::vector<std::string>& fileNames, unsigned int nThreads):
+  m_treeName(treeName),
+  m_fileNames(fileNames),
+  m_nThreads(nThreads),
+  m_msg("NtupleHistsDriver")
+{
+  if( m_nThreads == 0 ) m_nThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  m_msg.setLevel(MSG::INFO);
+}
+
+NtupleHistsDriver::~NtupleHistsDriver() {}
+
+StatusCode NtupleHistsDriver::run(const WorkerFactory& factory) {
+
+  // count the entries once, every thread opens its own chain
+  TChain counter(m_treeName.c_str());
+  for( const auto& fileName : m_fileNames ) counter.Add(fileName.c_str());
+  Long64_t nEntries = counter.GetEntries();
+
+  unsigned int nThreads = std::max<Long64_t>(std::min<Long64_t>(m_nThreads, nEntries), 1);
+  ANA_MSG_INFO( "Processing " << nEntries << " entries of " << m_treeName << " in " << nThreads << " threads" );
+
+  ROOT::EnableThreadSafety();
+  // the histograms of each worker stay out of the (shared) current directory
+  bool addDirectory = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+
+  m_workers.clear();
+  m_workers.resize(nThreads);
+  std::vector<StatusCode> results(nThreads, StatusCode::SUCCESS);
+  std::vector<std::thread> threads;
+
+  for( unsigned int iThread = 0; iThread < nThreads; iThread++ ){
+    Long64_t first = nEntries *  iThread    / nThreads;
+    Long64_t last  = nEntries * (iThread+1) / nThreads;
+
+    threads.emplace_back( [this, &factory, &results, iThread, first, last]() {
+      TChain chain(m_treeName.c_str());
+      for( const auto& fileName : m_fileNames ) chain.Add(fileName.c_str());
+
+      m_workers[iThread] = factory();
+      NtupleHistsWorker* worker = m_workers[iThread].get();
+      if( !worker || worker->initialize(&chain).isFailure() ) { results[iThread] = StatusCode::FAILURE; return; }
+
+      for( Long64_t entry = first; entry < last; entry++ ){
+        if( chain.GetEntry(entry) <= 0 || worker->execute().isFailure() ) { results[iThread] = StatusCode::FAILURE; return; }
+      }
+    } );
+  }
+
+  for( auto& thread : threads ) thread.join();
+  TH1::AddDirectory(addDirectory);
+
+  for( unsigned int iThread = 0; iThread < nThreads; iThread++ ){
+    if( results[iThread].isFailure() ) {
+      ANA_MSG_ERROR( "Worker " << iThread << " failed" );
+      return StatusCode::FAILURE;
+    }
+  }
+
+  // add everything to the histograms of the first worker
+  std::vector<HistogramManager*> merged = m_workers[0]->histograms();
+  for( unsigned int iThread = 1; iThread < nThreads; iThread++ ){
+    std::vector<HistogramManager*> hists = m_workers[iThread]->histograms();
+    if( hists.size() != merged.size() ) {
+      ANA_MSG_ERROR( "Worker " << iThread << " has " << hists.size() << " histogram sets instead of " << merged.size() );
+      return StatusCode::FAILURE;
+    }
+    for( unsigned int iHists = 0; iHists < merged.size(); iHists++ ){
+      ANA_CHECK( merged[iHists]->merge( *hists[iHists] ) );
+    }
+  }
+
+  return StatusCode::SUCCESS;
+}
+
+std::vector<HistogramManager*> NtupleHistsDriver::histograms() {
+  if( m_workers.empty() || !m_workers[0] ) return std::vector<HistogramManager*>();
+  return m_workers[0]->histograms();
+}
+
+MsgStream& NtupleHistsDriver :: msg () const {
+  return m_msg;
+}
+
+MsgStream& NtupleHistsDriver :: msg (int level) const {
+  MsgStream& result = msg();
+  result << MSG::Level (level);
+  return result;
+}
@@ -336,6 +336,14 @@ EL::StatusCode OverlapRemover :: finalize ()
 
   ANA_MSG_INFO( "Deleting tool instances...");
 
+  if ( m_useCutFlow ) {
+    m_el_cutflowCounter_1.materialize();
+    m_mu_cutflowCounter_1.materialize();
+    m_jet_cutflowCounter_1.materialize();
+    m_ph_cutflowCounter_1.materialize();
+    m_tau_cutflowCounter_1.materialize();
+  }
+
   return EL::StatusCode::SUCCESS;
 }
 
@@ -380,26 +388,26 @@ EL::StatusCode OverlapRemover :: fillObjectCutflow (const xAOD::IParticleContain
       case xAOD::Type::Electron:
         type = "electron";
         if (!overlapAcc( *obj_itr ))
-          m_el_cutflowHist_1->Fill( m_el_cutflow_OR_cut, 1 );
+          m_el_cutflowCounter_1.fill( m_el_cutflow_OR_cut );
         break;
       case xAOD::Type::Muon:
         if (!overlapAcc( *obj_itr ))
-          m_mu_cutflowHist_1->Fill( m_mu_cutflow_OR_cut, 1 );
+          m_mu_cutflowCounter_1.fill( m_mu_cutflow_OR_cut );
         type = "muon";
         break;
       case xAOD::Type::Jet:
         if (!overlapAcc( *obj_itr ))
-          m_jet_cutflowHist_1->Fill( m_jet_cutflow_OR_cut, 1 );
+          m_jet_cutflowCounter_1.fill( m_jet_cutflow_OR_cut );
         type = "jet";
         break;
       case xAOD::Type::Photon:
         if (!overlapAcc( *obj_itr ))
-          m_ph_cutflowHist_1->Fill( m_ph_cutflow_OR_cut, 1 );
+          m_ph_cutflowCounter_1.fill( m_ph_cutflow_OR_cut );
         type = "photon";
         break;
       case xAOD::Type::Tau:
         if (!overlapAcc( *obj_itr ))
-          m_tau_cutflowHist_1->Fill( m_tau_cutflow_OR_cut, 1 );
+          m_tau_cutflowCounter_1.fill( m_tau_cutflow_OR_cut );
         type = "tau";
         break;
       default:
@@ -1128,6 +1136,12 @@ EL::StatusCode OverlapRemover :: setCutFlowHist( )
     m_ph_cutflow_OR_cut   = m_ph_cutflowHist_1->GetXaxis()->FindBin("OR_cut");
     m_tau_cutflowHist_1   = (TH1D*)file->Get("cutflow_taus_1");
     m_tau_cutflow_OR_cut  = m_tau_cutflowHist_1->GetXaxis()->FindBin("OR_cut");
+
+    m_el_cutflowCounter_1.setHistograms( m_el_cutflowHist_1 );
+    m_mu_cutflowCounter_1.setHistograms( m_mu_cutflowHist_1 );
+    m_jet_cutflowCounter_1.setHistograms( m_jet_cutflowHist_1 );
+    m_ph_cutflowCounter_1.setHistograms( m_ph_cutflowHist_1 );
+    m_tau_cutflowCounter_1.setHistograms( m_tau_cutflowHist_1 );
   }
 
   return EL::StatusCode::SUCCESS;
@@ -128,6 +128,7 @@ void PhotonContainer::setTree(TTree *tree)
 
   tree->SetBranchStatus  ("nph" , 1);
   tree->SetBranchAddress ("nph" , &m_n);
+  if ( m_lazy ) return;
 
   if(m_infoSwitch.m_isolation){
     connectBranch<int>  (tree, "isIsolated_Cone40CaloOnly", &m_isIsolated_Cone40CaloOnly );
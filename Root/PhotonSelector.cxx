@@ -139,6 +139,7 @@ EL::StatusCode PhotonSelector :: initialize ()
     m_ph_cutflow_ptmin_cut       = m_ph_cutflowHist_1->GetXaxis()->FindBin("ptmin_cut");
     m_ph_cutflow_eta_cut         = m_ph_cutflowHist_1->GetXaxis()->FindBin("eta_cut"); // including crack veto, if applied
     m_ph_cutflow_iso_cut         = m_ph_cutflowHist_1->GetXaxis()->FindBin("iso_cut");
+    m_ph_cutflowCounter_1.setHistograms( m_ph_cutflowHist_1 );
 
 
   }
@@ -408,7 +409,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
     ANA_MSG_ERROR("Please call PhotonCalibrator before calling PhotonSelector, or check the quality requirement (should be either of Tight/Medium/Loose) [" << m_name << " " << photonIDKeyName << "]");
   }
 
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_all, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_all );
 
   // *********************************************************************************************************************************************************************
   //
@@ -420,7 +421,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
       return false;
     }
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_author_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_author_cut );
 
   // *********************************************************************************************************************************************************************
   //
@@ -441,7 +442,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
       }
     }
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_OQ_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_OQ_cut );
 
   // *********************************************************************************************************************************************************************
   //
@@ -454,7 +455,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
       return false;
     }
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_PID_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_PID_cut );
 
   // *********************************************************************************************************************************************************************
   //
@@ -466,7 +467,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
       return false;
     }
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_ptmax_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_ptmax_cut );
 
   // *********************************************************************************************************************************************************************
   //
@@ -478,7 +479,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
       return false;
     }
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_ptmin_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_ptmin_cut );
 
   // *********************************************************************************************************************************************************************
   //
@@ -501,7 +502,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
       return false;
     }
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_eta_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_eta_cut );
 
   // *********************************************************************************************************************************************************************
   //
@@ -531,7 +532,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
     ANA_MSG_DEBUG( "Photon failed isolation cut " << m_MinIsoWPCut );
     return false;
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_iso_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_iso_cut );
 
   return true;
 }
@@ -568,6 +569,7 @@ EL::StatusCode PhotonSelector :: finalize ()
     ANA_MSG_INFO( "Filling cutflow");
     m_cutflowHist ->SetBinContent( m_cutflow_bin, m_numEventPass        );
     m_cutflowHistW->SetBinContent( m_cutflow_bin, m_weightNumEventPass  );
+    m_ph_cutflowCounter_1.materialize();
   }
 
   ANA_MSG_DEBUG("Cutflow filled");
@@ -145,6 +145,7 @@ void TauContainer::setTree(TTree *tree)
   //
   // Connect branches
   ParticleContainer::setTree(tree);
+  if ( m_lazy ) return;
 
   if ( m_infoSwitch.m_trigger ){
     connectBranch<int>         (tree, "isTrigMatched",        &m_isTrigMatched);
@@ -153,12 +153,14 @@ EL::StatusCode TauSelector :: initialize ()
 
     m_tau_cutflow_all                  = m_tau_cutflowHist_1->GetXaxis()->FindBin("all");
     m_tau_cutflow_selected             = m_tau_cutflowHist_1->GetXaxis()->FindBin("selected");
+    m_tau_cutflowCounter_1.setHistograms( m_tau_cutflowHist_1 );
 
     if ( m_isUsedBefore ) {
       m_tau_cutflowHist_2 = (TH1D*)file->Get("cutflow_taus_2");
 
       m_tau_cutflow_all                  = m_tau_cutflowHist_2->GetXaxis()->FindBin("all");
       m_tau_cutflow_selected             = m_tau_cutflowHist_2->GetXaxis()->FindBin("selected");
+      m_tau_cutflowCounter_2.setHistograms( m_tau_cutflowHist_2 );
     }
 
   }
@@ -644,6 +646,8 @@ EL::StatusCode TauSelector :: finalize ()
     ANA_MSG_INFO( "Filling cutflow");
     m_cutflowHist ->SetBinContent( m_cutflow_bin, m_numEventPass        );
     m_cutflowHistW->SetBinContent( m_cutflow_bin, m_weightNumEventPass  );
+    m_tau_cutflowCounter_1.materialize();
+    m_tau_cutflowCounter_2.materialize();
   }
 
   return EL::StatusCode::SUCCESS;
@@ -672,8 +676,8 @@ EL::StatusCode TauSelector :: histFinalize ()
 int TauSelector :: passCuts( const xAOD::TauJet* tau ) {
 
   // fill cutflow bin 'all' before any cut
-  if(!m_isUsedBefore && m_useCutFlow) m_tau_cutflowHist_1->Fill( m_tau_cutflow_all, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_tau_cutflowHist_2->Fill( m_tau_cutflow_all, 1 ); }
+  if(!m_isUsedBefore && m_useCutFlow) m_tau_cutflowCounter_1.fill( m_tau_cutflow_all );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_tau_cutflowCounter_2.fill( m_tau_cutflow_all ); }
 
   // **********************************************************************************************************
   //
@@ -786,8 +790,8 @@ int TauSelector :: passCuts( const xAOD::TauJet* tau ) {
     return 0;
   }
 
-  if( !m_isUsedBefore && m_useCutFlow) m_tau_cutflowHist_1->Fill( m_tau_cutflow_selected, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_tau_cutflowHist_2->Fill( m_tau_cutflow_selected, 1 ); }
+  if( !m_isUsedBefore && m_useCutFlow) m_tau_cutflowCounter_1.fill( m_tau_cutflow_selected );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_tau_cutflowCounter_2.fill( m_tau_cutflow_selected ); }
 
   return 1;
 }
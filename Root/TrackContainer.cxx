@@ -101,6 +101,7 @@ TrackContainer::~TrackContainer()
 void TrackContainer::setTree(TTree *tree)
 {
   ParticleContainer::setTree(tree);
+  if ( m_lazy ) return;
 
   if(m_infoSwitch.m_fitpars){
     connectBranch<float>(tree, "chiSquared", &m_chiSquared);
@@ -2,6 +2,7 @@
 #include <EventLoop/Worker.h>
 
 #include "AthContainers/ConstDataVector.h"
+#include "xAODEventInfo/EventInfo.h"
 #include "xAODAnaHelpers/HelperFunctions.h"
 #include "xAODAnaHelpers/TrackSelector.h"
 
@@ -102,6 +103,7 @@ EL::StatusCode TrackSelector :: initialize ()
     m_cutflowHistW = (TH1D*)file->Get("cutflow_weighted");
     m_cutflow_bin  = m_cutflowHist->GetXaxis()->FindBin(m_name.c_str());
     m_cutflowHistW->GetXaxis()->FindBin(m_name.c_str());
+    m_cutflowCounter.setHistograms( m_cutflowHist, m_cutflowHistW );
   }
 
   // parse and split by comma
@@ -225,8 +227,7 @@ EL::StatusCode TrackSelector :: executeTrackCollection ()
 
   m_numEventPass++;
   if(m_useCutFlow) {
-    m_cutflowHist ->Fill( m_cutflow_bin, 1 );
-    m_cutflowHistW->Fill( m_cutflow_bin, mcEvtWeight);
+    m_cutflowCounter.fill( m_cutflow_bin, mcEvtWeight );
   }
 
   return EL::StatusCode::SUCCESS;
@@ -242,6 +243,9 @@ EL::StatusCode TrackSelector :: executeTracksInJets ()
   const xAOD::JetContainer* inJets(nullptr);
   ANA_CHECK( HelperFunctions::retrieve(inJets, m_inJetContainerName, m_event, m_store, msg()) );
 
+  const xAOD::EventInfo* eventInfo(nullptr);
+  ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
+
   //// get primary vertex
   //const xAOD::VertexContainer *vertices(nullptr);
   //ANA_CHECK( HelperFunctions::retrieve(vertices, m_vertexContainerName, m_event, m_store, msg()) );
@@ -270,6 +274,7 @@ EL::StatusCode TrackSelector :: executeTracksInJets ()
     //
     const vector<const xAOD::TrackParticle*> inputTracks = jet_itr->auxdata< vector<const xAOD::TrackParticle*>  >(m_inContainerName);
     const xAOD::Vertex* pvx                              = jet_itr->auxdata< const xAOD::Vertex*                 >(m_inContainerName+"_vtx");
+    m_trkSelCache.newEvent( eventInfo->runNumber(), eventInfo->eventNumber(), pvx );
     for(const xAOD::TrackParticle* trkInJet: inputTracks){
 
       nObj++;
@@ -277,7 +282,12 @@ EL::StatusCode TrackSelector :: executeTracksInJets ()
       //
       // Get cut desicion
       //
-      int passSel = this->PassCuts( trkInJet, pvx );
+      xAH::TrackSelectionCache::Decision decision = m_trkSelCache.decision( trkInJet );
+      if( decision == xAH::TrackSelectionCache::Unknown ) {
+        decision = this->PassCuts( trkInJet, pvx ) ? xAH::TrackSelectionCache::Pass : xAH::TrackSelectionCache::Fail;
+        m_trkSelCache.setDecision( trkInJet, decision == xAH::TrackSelectionCache::Pass );
+      }
+      int passSel = ( decision == xAH::TrackSelectionCache::Pass );
 
       //
       // if
@@ -329,6 +339,8 @@ EL::StatusCode TrackSelector :: finalize ()
 
   ANA_MSG_DEBUG("Deleting tool instances...");
 
+  if ( m_useCutFlow ) m_cutflowCounter.materialize();
+
   return EL::StatusCode::SUCCESS;
 }
 
@@ -576,6 +576,12 @@ EL::StatusCode TreeAlgo :: execute ()
 
     // fill the tree
     helpTree->Fill();
+
+    if ( m_writeEventIndex ) {
+      if ( !m_eventIndex ) m_eventIndex = new NtupleEventIndex();
+      TTree* outTree = helpTree->tree();
+      m_eventIndex->add( outTree->GetName(), eventInfo->runNumber(), eventInfo->eventNumber(), outTree->GetEntries()-1 );
+    }
   }
 
   return EL::StatusCode::SUCCESS;
@@ -586,6 +592,12 @@ EL::StatusCode TreeAlgo :: postExecute () { return EL::StatusCode::SUCCESS; }
 
 EL::StatusCode TreeAlgo :: finalize () {
 
+  if ( m_eventIndex ) {
+    ANA_MSG_INFO( "Writing the event index of " << m_eventIndex->size() << " entries...");
+    m_eventIndex->write( wk()->getOutputFile ("tree")->GetDirectory(m_name.c_str()) );
+    delete m_eventIndex; m_eventIndex = nullptr;
+  }
+
   ANA_MSG_INFO( "Deleting tree instances...");
 
   for(auto& item: m_trees){
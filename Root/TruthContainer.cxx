@@ -29,18 +29,32 @@ TruthContainer::TruthContainer(const std::string& name, const std::string& detai
 
   if(m_infoSwitch.m_parents){
     m_nParents        = new std::vector<int>();
-    m_parent_pdgId    = new std::vector< std::vector<int> >();
-    m_parent_barcode  = new std::vector< std::vector<int> >();
-    m_parent_status   = new std::vector< std::vector<int> >();
+    if(m_infoSwitch.m_flatLinks){
+      m_parent_begin  = new std::vector<int>();
+      m_parent_index  = new std::vector<int>();
+    }else{
+      m_parent_pdgId    = new std::vector< std::vector<int> >();
+      m_parent_barcode  = new std::vector< std::vector<int> >();
+      m_parent_status   = new std::vector< std::vector<int> >();
+    }
   }
 
   if(m_infoSwitch.m_children){
     m_nChildren      = new std::vector<int>();
-    m_child_pdgId    = new std::vector< std::vector<int> >();
-    m_child_barcode  = new std::vector< std::vector<int> >();
-    m_child_status   = new std::vector< std::vector<int> >();
+    if(m_infoSwitch.m_flatLinks){
+      m_child_begin  = new std::vector<int>();
+      m_child_index  = new std::vector<int>();
+    }else{
+      m_child_pdgId    = new std::vector< std::vector<int> >();
+      m_child_barcode  = new std::vector< std::vector<int> >();
+      m_child_status   = new std::vector< std::vector<int> >();
+    }
   }
 
+  m_linkContainer = nullptr;
+  m_nParentsResolved  = 0;
+  m_nChildrenResolved = 0;
+
 
 }
 
@@ -66,16 +80,26 @@ TruthContainer::~TruthContainer()
 
   if(m_infoSwitch.m_parents){
     delete m_nParents;
-    delete m_parent_pdgId;
-    delete m_parent_barcode;
-    delete m_parent_status;
+    if(m_infoSwitch.m_flatLinks){
+      delete m_parent_begin;
+      delete m_parent_index;
+    }else{
+      delete m_parent_pdgId;
+      delete m_parent_barcode;
+      delete m_parent_status;
+    }
   }
 
   if(m_infoSwitch.m_children){
     delete m_nChildren;
-    delete m_child_pdgId;
-    delete m_child_barcode;
-    delete m_child_status;
+    if(m_infoSwitch.m_flatLinks){
+      delete m_child_begin;
+      delete m_child_index;
+    }else{
+      delete m_child_pdgId;
+      delete m_child_barcode;
+      delete m_child_status;
+    }
   }
 
 }
@@ -85,6 +109,7 @@ void TruthContainer::setTree(TTree *tree)
   //
   // Connect branches
   ParticleContainer::setTree(tree);
+  if ( m_lazy ) return;
 
   connectBranch<int>(tree,"pdgId",                      &m_pdgId);
   connectBranch<int>(tree,"status",                     &m_status);
@@ -103,16 +128,26 @@ void TruthContainer::setTree(TTree *tree)
 
   if(m_infoSwitch.m_parents){
     connectBranch<int>(tree,"nParents",   &m_nParents);
-    connectBranch<std::vector<int> >(tree,"parent_pdgId",   &m_parent_pdgId);
-    connectBranch<std::vector<int> >(tree,"parent_barcode", &m_parent_barcode);
-    connectBranch<std::vector<int> >(tree,"parent_status",  &m_parent_status);
+    if(m_infoSwitch.m_flatLinks){
+      connectBranch<int>(tree,"parent_begin",   &m_parent_begin);
+      connectBranch<int>(tree,"parent_index",   &m_parent_index);
+    }else{
+      connectBranch<std::vector<int> >(tree,"parent_pdgId",   &m_parent_pdgId);
+      connectBranch<std::vector<int> >(tree,"parent_barcode", &m_parent_barcode);
+      connectBranch<std::vector<int> >(tree,"parent_status",  &m_parent_status);
+    }
   }
 
   if(m_infoSwitch.m_children){
     connectBranch<int>         (tree,"nChildren",     &m_nChildren);
-    connectBranch<std::vector<int> >(tree,"child_pdgId",   &m_child_pdgId);
-    connectBranch<std::vector<int> >(tree,"child_barcode", &m_child_barcode);
-    connectBranch<std::vector<int> >(tree,"child_status",  &m_child_status);
+    if(m_infoSwitch.m_flatLinks){
+      connectBranch<int>(tree,"child_begin",   &m_child_begin);
+      connectBranch<int>(tree,"child_index",   &m_child_index);
+    }else{
+      connectBranch<std::vector<int> >(tree,"child_pdgId",   &m_child_pdgId);
+      connectBranch<std::vector<int> >(tree,"child_barcode", &m_child_barcode);
+      connectBranch<std::vector<int> >(tree,"child_status",  &m_child_status);
+    }
   }
 
 }
@@ -141,16 +176,26 @@ void TruthContainer::updateParticle(uint idx, TruthPart& truth)
 
   if(m_infoSwitch.m_parents){
     truth.nParents       = m_nParents->at(idx);
-    truth.parent_pdgId   = m_parent_pdgId->at(idx);
-    truth.parent_barcode = m_parent_barcode->at(idx);
-    truth.parent_status  = m_parent_status ->at(idx);
+    if(m_infoSwitch.m_flatLinks){
+      std::vector<int>::const_iterator begin = m_parent_index->begin() + m_parent_begin->at(idx);
+      truth.parent_index.assign(begin, begin + truth.nParents);
+    }else{
+      truth.parent_pdgId   = m_parent_pdgId->at(idx);
+      truth.parent_barcode = m_parent_barcode->at(idx);
+      truth.parent_status  = m_parent_status ->at(idx);
+    }
   }
 
   if(m_infoSwitch.m_children){
     truth.nChildren     = m_nChildren->at(idx);
-    truth.child_pdgId   = m_child_pdgId->at(idx);
-    truth.child_barcode = m_child_barcode->at(idx);
-    truth.child_status  = m_child_status ->at(idx);
+    if(m_infoSwitch.m_flatLinks){
+      std::vector<int>::const_iterator begin = m_child_index->begin() + m_child_begin->at(idx);
+      truth.child_index.assign(begin, begin + truth.nChildren);
+    }else{
+      truth.child_pdgId   = m_child_pdgId->at(idx);
+      truth.child_barcode = m_child_barcode->at(idx);
+      truth.child_status  = m_child_status ->at(idx);
+    }
   }
 
 
@@ -182,16 +227,26 @@ void TruthContainer::setBranches(TTree *tree)
 
   if(m_infoSwitch.m_parents){
     setBranch<int>         (tree,"nParents",                      m_nParents              );
-    setBranch<std::vector<int> >(tree,"parent_pdgId",                  m_parent_pdgId          );
-    setBranch<std::vector<int> >(tree,"parent_barcode",                m_parent_barcode        );
-    setBranch<std::vector<int> >(tree,"parent_status",                 m_parent_status         );
+    if(m_infoSwitch.m_flatLinks){
+      setBranch<int>       (tree,"parent_begin",                  m_parent_begin          );
+      setBranch<int>       (tree,"parent_index",                  m_parent_index          );
+    }else{
+      setBranch<std::vector<int> >(tree,"parent_pdgId",                  m_parent_pdgId          );
+      setBranch<std::vector<int> >(tree,"parent_barcode",                m_parent_barcode        );
+      setBranch<std::vector<int> >(tree,"parent_status",                 m_parent_status         );
+    }
   }
 
   if(m_infoSwitch.m_children){
     setBranch<int>         (tree,"nChildren",                    m_nChildren            );
-    setBranch<std::vector<int> >(tree,"child_pdgId",                  m_child_pdgId          );
-    setBranch<std::vector<int> >(tree,"child_barcode",                m_child_barcode        );
-    setBranch<std::vector<int> >(tree,"child_status",                 m_child_status         );
+    if(m_infoSwitch.m_flatLinks){
+      setBranch<int>       (tree,"child_begin",                  m_child_begin          );
+      setBranch<int>       (tree,"child_index",                  m_child_index          );
+    }else{
+      setBranch<std::vector<int> >(tree,"child_pdgId",                  m_child_pdgId          );
+      setBranch<std::vector<int> >(tree,"child_barcode",                m_child_barcode        );
+      setBranch<std::vector<int> >(tree,"child_status",                 m_child_status         );
+    }
   }
 
 
@@ -221,18 +276,33 @@ void TruthContainer::clear()
 
   if(m_infoSwitch.m_parents){
     m_nParents->clear();
-    m_parent_pdgId->clear();
-    m_parent_barcode->clear();
-    m_parent_status->clear();
+    if(m_infoSwitch.m_flatLinks){
+      m_parent_begin->clear();
+      m_parent_index->clear();
+    }else{
+      m_parent_pdgId->clear();
+      m_parent_barcode->clear();
+      m_parent_status->clear();
+    }
   }
 
   if(m_infoSwitch.m_children){
     m_nChildren->clear();
-    m_child_pdgId->clear();
-    m_child_barcode->clear();
-    m_child_status->clear();
+    if(m_infoSwitch.m_flatLinks){
+      m_child_begin->clear();
+      m_child_index->clear();
+    }else{
+      m_child_pdgId->clear();
+      m_child_barcode->clear();
+      m_child_status->clear();
+    }
   }
 
+  m_linkContainer = nullptr;
+  m_outputIndex.clear();
+  m_nParentsResolved  = 0;
+  m_nChildrenResolved = 0;
+
   return;
 }
 
@@ -275,7 +345,23 @@ void TruthContainer::FillTruth( const xAOD::IParticle* particle ){
     }
   }
 
-  if(m_infoSwitch.m_parents){
+  if(m_infoSwitch.m_flatLinks && (m_infoSwitch.m_parents || m_infoSwitch.m_children)){
+    // remember where this particle goes, links are stored as container indices until FillTruthLinks
+    if(!m_linkContainer) m_linkContainer = truth->container();
+    if(truth->container() == m_linkContainer){
+      if(m_outputIndex.size() <= truth->index()) m_outputIndex.resize(truth->index()+1, -1);
+      m_outputIndex[truth->index()] = m_n-1;
+    }
+  }
+
+  if(m_infoSwitch.m_parents && m_infoSwitch.m_flatLinks){
+    int nParents = truth->nParents();
+    m_nParents->push_back(nParents);
+    m_parent_begin->push_back(m_parent_index->size());
+    for(int iparent = 0; iparent < nParents; ++iparent)
+      m_parent_index->push_back(linkIndex(truth->parent(iparent)));
+  }
+  else if(m_infoSwitch.m_parents){
     int nParents = truth->nParents();
     m_nParents->push_back(nParents);
 
@@ -297,7 +383,14 @@ void TruthContainer::FillTruth( const xAOD::IParticle* particle ){
   }
 
 
-  if(m_infoSwitch.m_children){
+  if(m_infoSwitch.m_children && m_infoSwitch.m_flatLinks){
+    int nChildren = truth->nChildren();
+    m_nChildren->push_back(nChildren);
+    m_child_begin->push_back(m_child_index->size());
+    for(int ichild = 0; ichild < nChildren; ++ichild)
+      m_child_index->push_back(linkIndex(truth->child(ichild)));
+  }
+  else if(m_infoSwitch.m_children){
     int nChildren = truth->nChildren();
     m_nChildren->push_back(nChildren);
 
@@ -323,3 +416,24 @@ void TruthContainer::FillTruth( const xAOD::IParticle* particle ){
   return;
 }
 
+int TruthContainer::linkIndex( const xAOD::TruthParticle* link ) const {
+  if(!link || link->container() != m_linkContainer) return -1;
+  return link->index();
+}
+
+void TruthContainer::FillTruthLinks(){
+  if(!m_infoSwitch.m_flatLinks) return;
+
+  // translate the container indices stored by FillTruth since the last call into positions in this collection
+  if(m_infoSwitch.m_parents)  resolveLinks(m_parent_index, m_nParentsResolved);
+  if(m_infoSwitch.m_children) resolveLinks(m_child_index,  m_nChildrenResolved);
+}
+
+void TruthContainer::resolveLinks( std::vector<int>* indices, size_t& nResolved ) const {
+  for(size_t i = nResolved; i < indices->size(); ++i){
+    int& index = indices->at(i);
+    if(index < 0) continue;
+    index = (static_cast<size_t>(index) < m_outputIndex.size()) ? m_outputIndex[index] : -1;
+  }
+  nResolved = indices->size();
+}
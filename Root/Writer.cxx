@@ -5,8 +5,13 @@
 
 #include "EventLoop/OutputStream.h"
 #include "xAODCore/ShallowCopy.h"
+#include "xAODCore/ShallowAuxContainer.h"
 #include "xAODJet/JetContainer.h"
 #include "xAODJet/JetAuxContainer.h"
+#include "xAODEgamma/ElectronContainer.h"
+#include "xAODEgamma/ElectronAuxContainer.h"
+#include "xAODMuon/MuonContainer.h"
+#include "xAODMuon/MuonAuxContainer.h"
 
 #include <xAODAnaHelpers/HelperFunctions.h>
 
@@ -100,12 +105,11 @@ EL::StatusCode Writer :: initialize ()
   TFile * file = wk()->getOutputFile (m_outputLabel.Data());
   ANA_CHECK( m_event->writeTo(file));
 
-  //FIXME add this as well
-// Set which variables not to write out:
-// event->setAuxItemList( "AntiKt4LCTopoJetsAux.", "-NumTrkPt1000.-NumTrkPt500" );
-// // Set which variable to do write out:
-// event->setAuxItemList( "GoodJetsAux.", "JetGhostArea.TrackCount" );
-
+  m_writeCounts.clear();
+  m_writeNames.clear();
+  for( const auto& names : {m_jetContainerNames, m_electronContainerNames, m_muonContainerNames} ) {
+    for( const auto& name : names ) m_writeNames.insert( name.Data() );
+  }
 
   return EL::StatusCode::SUCCESS;
 }
@@ -119,61 +123,83 @@ EL::StatusCode Writer :: execute ()
   // histograms and trees.  This is where most of your actual analysis
   // code will go.
   m_numEvent++;
+  m_copiedKeys.clear();
 
   // try to find the containers in m_event - if there then copy entire container directly
   // if not found in m_event, look in m_store - user created - write aux store as well
   for( auto contName : m_jetContainerNames ) {
+    ANA_CHECK( (writeContainer<xAOD::JetContainer, xAOD::JetAuxContainer>( contName.Data() )) );
+  }
+  for( auto contName : m_electronContainerNames ) {
+    ANA_CHECK( (writeContainer<xAOD::ElectronContainer, xAOD::ElectronAuxContainer>( contName.Data() )) );
+  }
+  for( auto contName : m_muonContainerNames ) {
+    ANA_CHECK( (writeContainer<xAOD::MuonContainer, xAOD::MuonAuxContainer>( contName.Data() )) );
+  }
 
-    const xAOD::JetContainer* inJetsConst(nullptr);
-    // look in event
-    if ( HelperFunctions::retrieve(inJetsConst, contName.Data(), m_event, 0, msg()).isSuccess() ) {
-      // without modifying the contents of it:
-      ANA_MSG_INFO( " Write a collection " << contName.Data() << inJetsConst->size() );
-      m_event->copy( contName.Data() );
-      ANA_MSG_INFO( " Wrote a collection " << contName.Data());
-      continue;
-    }
+  m_event->fill();
 
-    // look in store
-    xAOD::JetContainer* inJets(nullptr);
-    if ( HelperFunctions::retrieve(inJets, contName.Data(), 0, m_store, msg()).isSuccess() ){
-//      // FIXME add something like this
-//      jets_shallowCopy.second->setShallowIO( false ); // true = shallow copy, false = deep copy
-//      // if true should have something like this line somewhere:
-
-      // Record the objects into the output xAOD:
-      ANA_MSG_INFO( " Write a collection " << contName.Data() << inJets->size() );
-      if( ! m_event->record( inJets, contName.Data() ) ) {
-        ANA_MSG_ERROR(m_name << ": Could not record " << contName.Data());
-        return EL::StatusCode::FAILURE;
-      }
-      ANA_MSG_INFO( " Wrote a collection " << contName.Data());
-
-      // get pointer to associated aux container
-      xAOD::JetAuxContainer* inJetsAux = 0;
-      ANA_MSG_INFO( " Wrote a aux store " << contName.Data());
-      TString auxName( contName + "Aux." );
-      if ( HelperFunctions::retrieve(inJetsAux, auxName.Data(), 0, m_store, msg()).isSuccess() ){
-        ANA_MSG_ERROR(m_name << ": Could not get Aux data for " << contName.Data());
-        return EL::StatusCode::FAILURE;
-      }
-      ANA_MSG_INFO( " Wrote a aux store " << contName.Data());
-
-      if( ! m_event->record( inJetsAux, auxName.Data() ) ) {
-        ANA_MSG_ERROR( m_name << ": Could not record aux store for " << contName.Data());
-        return EL::StatusCode::FAILURE;
-      }
-    }
-    // could not find the container - problems
-    else {
-      ANA_MSG_ERROR( m_name << ": Could not find " << contName.Data());
-      return EL::StatusCode::FAILURE;
+  return EL::StatusCode::SUCCESS;
+}
+
+
+
+template<typename T, typename TAux>
+EL::StatusCode Writer :: writeContainer (const std::string& name)
+{
+  WriteCounts& counts = m_writeCounts[name];
+
+  // look in event - an input container, copy it without modifying the contents of it
+  const T* inConst(nullptr);
+  if ( HelperFunctions::retrieve(inConst, name, m_event, 0, msg()).isSuccess() ) {
+    if ( m_copiedKeys.insert(name).second ) {
+      ANA_CHECK( m_event->copy( name ) );
     }
+    ANA_MSG_DEBUG( "Copied " << name << " with " << inConst->size() << " objects" );
+    ++counts.copied;
+    return EL::StatusCode::SUCCESS;
   }
 
-  // add similar loop for electron and muons
+  // look in store
+  T* in(nullptr);
+  if ( !HelperFunctions::retrieve(in, name, 0, m_store, msg()).isSuccess() ) {
+    ANA_MSG_ERROR( m_name << ": Could not find " << name );
+    return EL::StatusCode::FAILURE;
+  }
 
-  m_event->fill();
+  const std::string auxName( name + "Aux." );
+  if ( m_store->contains<xAOD::ShallowAuxContainer>( auxName ) ) {
+    xAOD::ShallowAuxContainer* inAux(nullptr);
+    ANA_CHECK( m_store->retrieve( inAux, auxName ) );
+
+    // a shallow copy of an input container only needs the variables set on it, as long as the
+    // input container is written anyway - otherwise writing it would only make the output larger,
+    // so write all variables of the copy instead
+    std::string parentName( m_shallowIO ? inAux->parent().dataID() : "" );
+    if ( parentName.size() > 4 && parentName.compare( parentName.size()-4, 4, "Aux." ) == 0 ) parentName.resize( parentName.size()-4 );
+    const T* parent(nullptr);
+    bool shallow = !parentName.empty() && ( m_writeNames.count(parentName) || m_copiedKeys.count(parentName) )
+                   && HelperFunctions::retrieve(parent, parentName, m_event, 0, msg()).isSuccess();
+    inAux->setShallowIO( shallow );
+
+    if ( shallow && m_copiedKeys.insert(parentName).second ) {
+      ANA_CHECK( m_event->copy( parentName ) );
+    }
+
+    ANA_CHECK( (HelperFunctions::recordOutput<T, xAOD::ShallowAuxContainer>( m_event, m_store, name )) );
+    ANA_MSG_DEBUG( "Wrote " << name << " with " << in->size() << " objects as a " << (shallow ? "shallow copy of " + parentName : "deep copy") );
+    shallow ? ++counts.shallow : ++counts.deep;
+    return EL::StatusCode::SUCCESS;
+  }
+
+  // a container made by the user - write it and its aux store
+  if ( !m_store->contains<TAux>( auxName ) ) {
+    ANA_MSG_ERROR( m_name << ": Could not get Aux data for " << name );
+    return EL::StatusCode::FAILURE;
+  }
+  ANA_CHECK( (HelperFunctions::recordOutput<T, TAux>( m_event, m_store, name )) );
+  ANA_MSG_DEBUG( "Wrote " << name << " with " << in->size() << " objects" );
+  ++counts.deep;
 
   return EL::StatusCode::SUCCESS;
 }
@@ -202,6 +228,11 @@ EL::StatusCode Writer :: finalize ()
   // merged.  This is different from histFinalize() in that it only
   // gets called on worker nodes that processed input events.
 
+  for( const auto& counts : m_writeCounts ) {
+    ANA_MSG_INFO( "Wrote " << counts.first << ": " << counts.second.copied << " times from the input, "
+                  << counts.second.shallow << " times as shallow copy, " << counts.second.deep << " times as deep copy" );
+  }
+
   // finalize and close our output xAOD file ( and write MetaData tree )
   TFile * file = wk()->getOutputFile(m_outputLabel.Data());
   ANA_CHECK( m_event->finishWritingTo( file ));
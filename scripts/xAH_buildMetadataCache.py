@@ -0,0 +1,85 @@
+#!/usr/bin/env python
+# @file:    xAH_buildMetadataCache.py
+# @purpose: prebuild the BasicEventSelection meta data cache of local input files
+# @author:  See AUTHORS.md
+#
+# @example:
+# @code
+# xAH_buildMetadataCache.py -o metadata.cache -j 8 /data/mc16_13TeV.*/*.root*
+# @endcode
+#
+# The cache is then used with
+#   c.algorithm("BasicEventSelection", {"m_metaDataCacheFile": "/abs/path/metadata.cache", ...})
+#
+
+from __future__ import print_function
+
+import argparse
+import multiprocessing
+import os
+import sys
+
+parser = argparse.ArgumentParser(description="Read the CutBookkeepers of xAOD files in parallel and store them in a BasicEventSelection meta data cache",
+                                 formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+parser.add_argument('files', nargs='+', help='input xAOD files')
+parser.add_argument('-o', '--output', dest='output', required=True, help='cache file, updated if it exists')
+parser.add_argument('-j', '--jobs', dest='jobs', type=int, default=multiprocessing.cpu_count(), help='number of parallel processes')
+parser.add_argument('--derivationName', dest='derivationName', default='', help='same as BasicEventSelection.m_derivationName')
+
+def summarize(args):
+  iJob, fileNames, derivationName, output = args
+  # every process sets up its own ROOT
+  import ROOT
+  ROOT.xAOD.Init("xAH_buildMetadataCache").ignore()
+  ROOT.gSystem.Load("libxAODAnaHelpersLib.so")
+
+  cache = ROOT.FileMetadataCache()
+  cache.msg().setLevel(ROOT.MSG.WARNING)
+  failed = []
+  for fileName in fileNames:
+    if cache.summarizeFile(fileName, derivationName).isFailure(): failed.append(fileName)
+
+  partName = "{0:s}.part{1:d}".format(output, iJob)
+  if cache.size() and not cache.write(partName):
+    failed.extend(fileNames)
+    partName = None
+  return partName, failed
+
+if __name__ == "__main__":
+  args = parser.parse_args()
+  fileNames = [os.path.abspath(f) for f in args.files]
+
+  import ROOT
+  ROOT.gSystem.Load("libxAODAnaHelpersLib.so")
+  cache = ROOT.FileMetadataCache()
+  cache.read(args.output)
+
+  # only the files that are new or changed since they were cached
+  summary = ROOT.FileMetadataCache.Summary()
+  todo = [f for f in fileNames if not cache.find(f, args.derivationName, summary)]
+  print("{0:d} of {1:d} files are not cached yet".format(len(todo), len(fileNames)))
+  if not todo: sys.exit(0)
+
+  nJobs = max(min(args.jobs, len(todo)), 1)
+  chunks = [(iJob, todo[iJob::nJobs], args.derivationName, args.output) for iJob in range(nJobs)]
+  pool = multiprocessing.Pool(nJobs)
+  results = pool.map(summarize, chunks)
+  pool.close()
+  pool.join()
+
+  failed = []
+  for partName, partFailed in results:
+    failed.extend(partFailed)
+    if partName is None: continue
+    cache.read(partName)
+    os.remove(partName)
+
+  if not cache.write(args.output):
+    print("Could not write {0:s}".format(args.output))
+    sys.exit(1)
+  print("Wrote {0:d} file summaries to {1:s}".format(cache.size(), args.output))
+
+  if failed:
+    print("Could not read the meta data of:")
+    for f in failed: print("  {0:s}".format(f))
+    sys.exit(1)
@@ -14,8 +14,17 @@
 // ROOT include(s):
 #include "TH1D.h"
 
+#include <deque>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
+
+class FileMetadataCache;
 
 // external tools include(s):
 #include "AsgTools/AnaToolHandle.h"
@@ -178,6 +187,12 @@ class BasicEventSelection : public xAH::Algorithm
     std::string m_derivationName = "";
     /// @brief Retrieve and save information on DAOD selection
     bool m_useMetaData = true;
+    /**
+      @rst
+        Text file caching the bookkeeping of each input file (see :cpp:class:`FileMetadataCache`). Files found in it, with unchanged size and modification time, are not read for their ``MetaData``; new files are added at the end of the job. Empty disables the cache.
+      @endrst
+    */
+    std::string m_metaDataCacheFile = "";
 
     /* Output Stream Names */
 
@@ -196,15 +211,68 @@ class BasicEventSelection : public xAH::Algorithm
     bool m_checkDuplicatesData = false;
     /** Check for duplicated events in MC */
     bool m_checkDuplicatesMC = false;
+    /**
+      @brief Number of most recently started runs whose event numbers are kept for the duplicate check, 0 keeps all runs
+      @rst
+        Only set this when the input is grouped by run (e.g. one dataset per run): the events of a run are released once this many newer runs have been seen, so a duplicate that comes back after that is not found. Memory then stays bounded by the largest runs instead of growing with the whole job.
+      @endrst
+    */
+    unsigned int m_duplicatesRunWindow = 0;
+
+    /**
+      @brief File listing the (run number, event number) pairs to process, one pair per line; empty processes all events
+      @rst
+        Events that are not listed are skipped as the very first step of :cpp:func:`BasicEventSelection::execute`, using only ``EventInfo``: no other container is read and no tool runs for them. Lines starting with ``#`` are ignored. The file is found with ``PathResolverFindCalibFile``.
+      @endrst
+    */
+    std::string m_eventListFile = "";
+
+    /** Write the ``lumiBlocks`` tree with the GRL decision, number and sum of weights of the processed data events per (run, lumi block) to the cutflow stream */
+    bool m_storeLumiBlockCutflow = false;
 
   private:
 
-    std::set<std::pair<uint32_t,uint32_t> > m_RunNr_VS_EvtNr; //!
+    // (run number, event number) pairs of m_eventListFile, sorted
+    std::vector<std::pair<uint32_t, uint64_t> > m_eventList; //!
+    uint64_t m_eventListRejected = 0; //!
+
+    // event numbers seen so far per run, and the runs in the order they started
+    std::unordered_map<uint32_t, std::unordered_set<uint64_t> > m_RunNr_VS_EvtNr; //!
+    std::deque<uint32_t> m_duplicatesRunOrder; //!
+
+    // lumi-block scoped decisions and event counts, evaluated once per (run, lumi block)
+    struct LumiBlockInfo {
+      bool      passGRL;
+      ULong64_t nEvents;
+      double    sumOfWeights;
+    };
+    std::map<std::pair<uint32_t,uint32_t>, LumiBlockInfo> m_lumiBlocks; //!
+    LumiBlockInfo* m_currentLumiBlock = nullptr; //!
+    uint32_t m_currentRunNumber = 0;             //!
+    uint32_t m_currentLumiBlockNr = 0;           //!
+
+    // PRW_DATASF up/down weights, which only depend on (runNumber, mcChannelNumber, averageMu, actualMu)
+    std::map<std::tuple<uint32_t,uint32_t,float,float>, std::pair<float,float> > m_PUweightSysCache; //!
+    // the PRW tool is left at a systematic variation and has to be set back to nominal
+    bool m_PUtoolVaried = false; //!
     // trigger unprescale chains
     std::vector<std::string> m_triggerUnprescaleList; //!
     // decisions of triggers which are saved but not cut on, converted into a list
     std::vector<std::string> m_extraTriggerSelectionList; //!
 
+    // chain groups of m_triggerSelection and of the stored chains, resolved once per trigger configuration
+    struct TriggerChain {
+      std::string             name;
+      const Trig::ChainGroup* chainGroup;
+      bool                    lumiPrescale; // all chains of the group are in m_triggerUnprescaleList
+    };
+    const Trig::ChainGroup*   m_triggerChainGroup = nullptr; //!
+    std::vector<TriggerChain> m_selectionChains;             //!
+    std::vector<TriggerChain> m_extraChains;                 //!
+    uint32_t m_trigMasterKey = 0;                            //!
+    uint32_t m_trigL1PSKey   = 0;                            //!
+    uint32_t m_trigHLTPSKey  = 0;                            //!
+
     // tools
     asg::AnaToolHandle<IGoodRunsListSelectionTool> m_grl_handle                  {"GoodRunsListSelectionTool"                                      , this}; //!
     asg::AnaToolHandle<CP::IPileupReweightingTool> m_pileup_tool_handle          {"CP::PileupReweightingTool/Pileup"                                            }; //!
@@ -223,10 +291,12 @@ class BasicEventSelection : public xAH::Algorithm
     double m_MD_initialSumWSquared;  //!
     double m_MD_finalSumWSquared;    //!
     std::string m_mcCampaignMD; //!
+    FileMetadataCache* m_metaDataCache = nullptr; //!
 
     // cutflow
     TH1D* m_cutflowHist = nullptr;      //!
     TH1D* m_cutflowHistW = nullptr;     //!
+    xAH::CutflowCounter m_cutflowCounter; //!
     int m_cutflow_all;        //!
     int m_cutflow_init;       //!
     int m_cutflow_duplicates; //!
@@ -273,6 +343,9 @@ class BasicEventSelection : public xAH::Algorithm
     */
     StatusCode autoconfigurePileupRWTool();
 
+    /** @brief Resolve the trigger chain groups, if the trigger configuration keys changed since the last call */
+    void resolveTriggerChains();
+
   public:
     // Tree *myTree; //!
     // TH1 *myHist; //!
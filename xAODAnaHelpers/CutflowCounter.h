@@ -0,0 +1,52 @@
+#ifndef xAODAnaHelpers_CutflowCounter_H
+#define xAODAnaHelpers_CutflowCounter_H
+
+#include <atomic>
+#include <memory>
+
+#include <TH1D.h>
+
+namespace xAH {
+
+  /**
+   * Accumulates the counts of a cutflow histogram (and optionally its
+   * weighted twin) in a plain array of atomic counters, and only adds them
+   * to the histograms in ``materialize``, instead of a ``TH1::Fill`` per
+   * cut, object and event.
+   *
+   * The bins are the ones of the histogram at ``setHistograms`` time, so it
+   * has to be called after the algorithm labelled its bins with ``FindBin``.
+   * ``fill`` is safe to call concurrently; ``setHistograms`` and
+   * ``materialize`` are not.
+   */
+  class CutflowCounter
+  {
+  public:
+    CutflowCounter();
+
+    /** Count into ``hist`` (unweighted) and ``histW`` (weighted, may be null) */
+    void setHistograms(TH1D* hist, TH1D* histW = nullptr);
+
+    /** Count one entry in ``bin``; ``weight`` only goes to the weighted histogram */
+    void fill(int bin, double weight = 1.);
+
+    /** Add the counts to the histograms and reset them; call in ``finalize`` */
+    void materialize();
+
+  private:
+    struct Bin {
+      std::atomic<unsigned long long> n{0};
+      std::atomic<double>             sumW{0.};
+      std::atomic<double>             sumW2{0.};
+    };
+
+    static void add(std::atomic<double>& sum, double value);
+
+    TH1D* m_hist;
+    TH1D* m_histW;
+    int   m_nBins;
+    std::unique_ptr<Bin[]> m_bins;
+  };
+
+}//xAH
+#endif // xAODAnaHelpers_CutflowCounter_H
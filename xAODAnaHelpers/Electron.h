@@ -18,6 +18,7 @@ namespace xAH {
     int               isTrigMatched;
     std::vector<int>  isTrigMatchedToChain;
     std::string       listTrigChains;
+    ULong64_t         trigMatchMask; // bit i set if matched to trigMatchChains()[i] of the container
 
     // isolation
     std::map< std::string, int > isIsolated;
@@ -26,6 +26,7 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
 
 // forward-declare for now until IsolationSelectionTool interface is updated
 namespace CP {
@@ -231,7 +232,9 @@ private:
   /* object-level cutflow */
 
   TH1D* m_el_cutflowHist_1 = nullptr;            //!
+  xAH::CutflowCounter m_el_cutflowCounter_1; //!
   TH1D* m_el_cutflowHist_2 = nullptr;            //!
+  xAH::CutflowCounter m_el_cutflowCounter_2; //!
 
   int   m_el_cutflow_all;              //!
   int   m_el_cutflow_author_cut;       //!
@@ -94,6 +94,11 @@ namespace xAH {
     std::vector<float> m_caloCluster_phi;
     std::vector<float> m_caloCluster_e;
 
+  private:
+
+    /// rho of the named xAOD::EventShape, -999 if it is not available
+    double eventShapeDensity( xAOD::TEvent* event, const std::string& name ) const;
+
   };
 
   template <typename T_BR> void EventInfo::connectBranch(TTree *tree, std::string name, T_BR *variable)
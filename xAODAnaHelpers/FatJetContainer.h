@@ -31,6 +31,7 @@ namespace xAH {
       virtual void setTree    (TTree *tree);
       virtual void setBranches(TTree *tree);
       virtual void clear();
+      virtual void quantizeBranches();
       virtual void FillFatJet( const xAOD::Jet* jet );
       virtual void FillFatJet( const xAOD::IParticle* particle );
       using ParticleContainer::setTree; // make other overloaded version of execute() to show up in subclass
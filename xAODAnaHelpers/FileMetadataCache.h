@@ -0,0 +1,95 @@
+#ifndef xAODAnaHelpers_FileMetadataCache_H
+#define xAODAnaHelpers_FileMetadataCache_H
+
+/** @file FileMetadataCache.h
+ *  @brief On-disk cache of the per-file bookkeeping read by BasicEventSelection
+ *  @author See AUTHORS.md
+ */
+
+#include <TTree.h>
+
+#include <map>
+#include <string>
+
+#include <AsgTools/MsgStream.h>
+#include <AsgTools/StatusCode.h>
+
+namespace xAOD {
+  class TEvent;
+}
+
+/**
+    @brief Per-file CutBookkeeper sums, keyed by the path, size and modification time of the input file
+    @rst
+        :cpp:class:`BasicEventSelection` with ``m_metaDataCacheFile`` looks up every input file here before opening its ``MetaData`` tree, and only reads the bookkeepers of files that are not in the cache (or changed since). New entries are written back to the cache file at the end of the job.
+
+        The cache is a text file with one tab-separated line per (file, ``m_derivationName``), so it can be inspected and merged by hand. Files that cannot be stat'ed are never cached. The cache can be prebuilt in parallel with ``xAH_buildMetadataCache.py``::
+
+            xAH_buildMetadataCache.py -o metadata.cache -j 8 /data/mc16_13TeV.*/*.root*
+
+    @endrst
+ */
+class FileMetadataCache {
+  public:
+    /** @brief The bookkeeping of one file, as filled into the cutflow and ``MetaData_EventCount`` histograms */
+    struct Summary {
+      bool        isDerivation = false;
+      /// name of the CutBookkeeper used for the selected events, empty for non-derivations
+      std::string derivationAlg;
+      uint64_t    initialNevents = 0;
+      uint64_t    finalNevents = 0;
+      double      initialSumW = 0;
+      double      finalSumW = 0;
+      double      initialSumWSquared = 0;
+      double      finalSumWSquared = 0;
+    };
+
+    FileMetadataCache();
+
+    /** @brief Add the entries of the cache file ``fileName``, false if it cannot be read */
+    bool read(const std::string& fileName);
+
+    /** @brief Write all entries to ``fileName``; written to a temporary file first and renamed */
+    bool write(const std::string& fileName) const;
+
+    /** @brief Add the entries of ``other``, replacing those of the same files */
+    void merge(const FileMetadataCache& other);
+
+    /** @brief The summary of ``fileName`` as read with ``derivationName``, false if it is not cached or the file changed */
+    bool find(const std::string& fileName, const std::string& derivationName, Summary& summary) const;
+
+    /** @brief Cache the summary of ``fileName``; ignored if the file cannot be stat'ed */
+    void add(const std::string& fileName, const std::string& derivationName, const Summary& summary);
+
+    /** @brief Read the (incomplete) CutBookkeepers of the file connected to ``event``, selecting the derivation like :cpp:class:`BasicEventSelection` */
+    StatusCode summarize(xAOD::TEvent* event, TTree* MetaData, const std::string& derivationName, Summary& summary);
+
+    /** @brief Open ``fileName``, summarize it and add it to the cache; needs ``xAOD::Init`` */
+    StatusCode summarizeFile(const std::string& fileName, const std::string& derivationName);
+
+    /** @brief Whether entries were added since the cache was read */
+    bool modified() const { return m_modified; }
+
+    size_t size() const { return m_entries.size(); }
+
+    /** @brief the standard message stream for the cache */
+    MsgStream& msg () const;
+    MsgStream& msg (int level) const;
+
+  private:
+    struct Entry {
+      Long64_t size;
+      Long_t   modTime;
+      Summary  summary;
+    };
+
+    static bool fileStat(const std::string& fileName, Long64_t& size, Long_t& modTime);
+
+    /// keyed by (file name, requested derivation name)
+    std::map< std::pair<std::string, std::string>, Entry > m_entries;
+    bool m_modified;
+
+    mutable MsgStream m_msg; //!
+};
+
+#endif
@@ -41,15 +41,18 @@
 #include "xAODAnaHelpers/TrackContainer.h"
 #include "xAODAnaHelpers/MuonContainer.h"
 #include "xAODAnaHelpers/TauContainer.h"
+#include "xAODAnaHelpers/TrackSelectionCache.h"
 #include "xAODRootAccess/TEvent.h"
 #include "xAODRootAccess/TStore.h"
 
 
 #include <map>
+#include <unordered_map>
 
 // root includes
 #include "TTree.h"
 #include "TFile.h"
+#include "TList.h"
 
 namespace TrigConf {
   class xAODConfigTool;
@@ -69,17 +72,25 @@ public:
   HelpTreeBase(TTree* tree, TFile* file, xAOD::TEvent *event = nullptr, xAOD::TStore* store = nullptr, const float units = 1e3, bool debug = false );
   virtual ~HelpTreeBase();
 
-  void AddEvent       (const std::string detailStr = "");
-  void AddTrigger     (const std::string detailStr = "");
-  void AddJetTrigger  (const std::string detailStr = "");
-  void AddMuons       (const std::string detailStr = "", const std::string muonName = "muon");
-  void AddElectrons   (const std::string detailStr = "", const std::string elecName = "el");
-  void AddPhotons     (const std::string detailStr = "", const std::string photonName = "ph");
-  void AddClusters    (const std::string detailStr = "", const std::string clusterName = "cl");
-  void AddJets        (const std::string detailStr = "", const std::string jetName = "jet");
-  void AddL1Jets      ();
-  void AddTruthParts  (const std::string truthName,      const std::string detailStr = "");
-  void AddTrackParts  (const std::string trackName,	 const std::string detailStr = "");
+  void AddEvent       (const std::string& detailStr = "");
+  void AddTrigger     (const std::string& detailStr = "");
+  void AddJetTrigger  (const std::string& detailStr = "");
+
+  /**
+   *  @brief  The ``Add*`` methods for object collections return a handle to the branch container
+   *          they created. Passing that handle to the matching ``Fill*`` / ``Clear*`` overload
+   *          skips the by-name lookup, so filling a collection costs no string comparisons or
+   *          copies per object. The handle is owned by this class and stays valid for its lifetime.
+   *          The by-name overloads are kept and resolve the handle once per collection.
+   **/
+  xAH::MuonContainer*     AddMuons       (const std::string& detailStr = "", const std::string& muonName = "muon");
+  xAH::ElectronContainer* AddElectrons   (const std::string& detailStr = "", const std::string& elecName = "el");
+  xAH::PhotonContainer*   AddPhotons     (const std::string& detailStr = "", const std::string& photonName = "ph");
+  xAH::ClusterContainer*  AddClusters    (const std::string& detailStr = "", const std::string& clusterName = "cl");
+  xAH::JetContainer*      AddJets        (const std::string& detailStr = "", const std::string& jetName = "jet");
+  void                    AddL1Jets      ();
+  xAH::TruthContainer*    AddTruthParts  (const std::string& truthName,      const std::string& detailStr = "");
+  xAH::TrackContainer*    AddTrackParts  (const std::string& trackName,      const std::string& detailStr = "");
 
   /**
    *  @brief  Declare a new collection of fatjets to be written to the output tree.
@@ -89,12 +100,14 @@ public:
    *                      `constituentAll`
    *  @param  fatjetName  The (prefix) name of the container. Default: `fatjet`.
    *  @param  subjetDetailStr List of detail options to pass to the subjet container. See :cpp:member:`HelpTreeBase::AddJets` for list of supported values.
+   *
+   *  @return a handle that can be passed to `FillFatJets()` / `ClearFatJets()`.
    **/
-  void AddFatJets     (const std::string detailStr = "", const std::string fatjetName = "fatjet", const std::string subjetDetailStr="", const std::string suffix="");
-  void AddTruthFatJets(const std::string detailStr = "", const std::string truthFatJetName = "truth_fatjet");
+  xAH::FatJetContainer*   AddFatJets     (const std::string& detailStr = "", const std::string& fatjetName = "fatjet", const std::string& subjetDetailStr="", const std::string& suffix="");
+  xAH::FatJetContainer*   AddTruthFatJets(const std::string& detailStr = "", const std::string& truthFatJetName = "truth_fatjet");
 
-  void AddTaus        (const std::string detailStr = "", const std::string tauName = "tau");
-  void AddMET         (const std::string detailStr = "", const std::string metName = "met");
+  xAH::TauContainer*      AddTaus        (const std::string& detailStr = "", const std::string& tauName = "tau");
+  xAH::MetContainer*      AddMET         (const std::string& detailStr = "", const std::string& metName = "met");
 
   /**
    *  @brief  Helper function to lookup each fatjet container name/suffix combo in the internal map
@@ -105,7 +118,7 @@ public:
    *
    *  @return a string that uniquely identifies the collection name/suffix in the lookup map.
    **/
-  static std::string FatJetCollectionName(const std::string fatjetName = "fatjet", const std::string suffix = "");
+  static std::string FatJetCollectionName(const std::string& fatjetName = "fatjet", const std::string& suffix = "");
 
   xAOD::TEvent* m_event;
   xAOD::TStore* m_store;
@@ -125,27 +138,41 @@ public:
   void FillTrigger( const xAOD::EventInfo* eventInfo );
   void FillJetTrigger();
 
-  void FillMuons( const xAOD::MuonContainer* muons, const xAOD::Vertex* primaryVertex, const std::string muonName = "muon" );
-  void FillMuon( const xAOD::Muon* muon, const xAOD::Vertex* primaryVertex, const std::string muonName = "muon" );
-
-  void FillElectrons( const xAOD::ElectronContainer* electrons, const xAOD::Vertex* primaryVertex, const std::string elecName = "el" );
-  void FillElectron ( const xAOD::Electron* elec, const xAOD::Vertex* primaryVertex, const std::string elecName = "el" );
-
-  void FillPhotons( const xAOD::PhotonContainer* photons, const std::string photonName = "ph" );
-  void FillPhoton ( const xAOD::Photon*          photon,  const std::string photonName = "ph" );
-
-  void FillClusters( const xAOD::CaloClusterContainer* clusters, const std::string clusterName = "cl" );
-  void FillCluster ( const xAOD::CaloCluster*          cluster,  const std::string clusterName = "cl" );
-
-  void FillJets( const xAOD::JetContainer* jets, int pvLocation = -1, const std::string jetName = "jet" );
-  void FillJet( const xAOD::Jet* jet_itr, const xAOD::Vertex* pv, int pvLocation, const std::string jetName = "jet" );
+  void FillMuons( const xAOD::MuonContainer* muons, const xAOD::Vertex* primaryVertex, const std::string& muonName = "muon" );
+  void FillMuon( const xAOD::Muon* muon, const xAOD::Vertex* primaryVertex, const std::string& muonName = "muon" );
+  void FillMuons( xAH::MuonContainer* muonHandle, const xAOD::MuonContainer* muons, const xAOD::Vertex* primaryVertex );
+  void FillMuon ( xAH::MuonContainer* muonHandle, const xAOD::Muon* muon,           const xAOD::Vertex* primaryVertex );
+
+  void FillElectrons( const xAOD::ElectronContainer* electrons, const xAOD::Vertex* primaryVertex, const std::string& elecName = "el" );
+  void FillElectron ( const xAOD::Electron* elec, const xAOD::Vertex* primaryVertex, const std::string& elecName = "el" );
+  void FillElectrons( xAH::ElectronContainer* elecHandle, const xAOD::ElectronContainer* electrons, const xAOD::Vertex* primaryVertex );
+  void FillElectron ( xAH::ElectronContainer* elecHandle, const xAOD::Electron* elec,               const xAOD::Vertex* primaryVertex );
+
+  void FillPhotons( const xAOD::PhotonContainer* photons, const std::string& photonName = "ph" );
+  void FillPhoton ( const xAOD::Photon*          photon,  const std::string& photonName = "ph" );
+  void FillPhotons( xAH::PhotonContainer* photonHandle, const xAOD::PhotonContainer* photons );
+  void FillPhoton ( xAH::PhotonContainer* photonHandle, const xAOD::Photon*          photon  );
+
+  void FillClusters( const xAOD::CaloClusterContainer* clusters, const std::string& clusterName = "cl" );
+  void FillCluster ( const xAOD::CaloCluster*          cluster,  const std::string& clusterName = "cl" );
+  void FillClusters( xAH::ClusterContainer* clusterHandle, const xAOD::CaloClusterContainer* clusters );
+  void FillCluster ( xAH::ClusterContainer* clusterHandle, const xAOD::CaloCluster*          cluster  );
+
+  void FillJets( const xAOD::JetContainer* jets, int pvLocation = -1, const std::string& jetName = "jet" );
+  void FillJet( const xAOD::Jet* jet_itr, const xAOD::Vertex* pv, int pvLocation, const std::string& jetName = "jet" );
+  void FillJets( xAH::JetContainer* jetHandle, const xAOD::JetContainer* jets, int pvLocation = -1 );
+  void FillJet ( xAH::JetContainer* jetHandle, const xAOD::Jet* jet_itr, const xAOD::Vertex* pv, int pvLocation );
   void FillL1Jets( const xAOD::JetRoIContainer* jets, bool sortL1Jets = false );
 
-  void FillTruth( const std::string truthName, const xAOD::TruthParticleContainer* truth);
-  void FillTruth( const xAOD::TruthParticle* truthPart, const std::string truthName );
+  void FillTruth( const std::string& truthName, const xAOD::TruthParticleContainer* truth);
+  void FillTruth( const xAOD::TruthParticle* truthPart, const std::string& truthName );
+  void FillTruth( xAH::TruthContainer* truthHandle, const xAOD::TruthParticleContainer* truth );
+  void FillTruth( xAH::TruthContainer* truthHandle, const xAOD::TruthParticle* truthPart );
 
-  void FillTracks( const std::string trackName, const xAOD::TrackParticleContainer* tracks);
-  void FillTrack( const xAOD::TrackParticle* trackPart, const std::string trackName );
+  void FillTracks( const std::string& trackName, const xAOD::TrackParticleContainer* tracks);
+  void FillTrack( const xAOD::TrackParticle* trackPart, const std::string& trackName );
+  void FillTracks( xAH::TrackContainer* trackHandle, const xAOD::TrackParticleContainer* tracks );
+  void FillTrack ( xAH::TrackContainer* trackHandle, const xAOD::TrackParticle* trackPart );
 
   /**
    *  @brief  Write a container of jets to the specified container name (and optionally suffix). The
@@ -156,32 +183,53 @@ public:
    *  @param  fatjetName  The name of the output collection to write to.
    *  @param  suffix      The suffix of the output collection to write to.
    */
-  void FillFatJets( const xAOD::JetContainer* fatJets , const std::string fatjetName = "fatjet", const std::string suffix = "");
-  void FillFatJet ( const xAOD::Jet* fatjet_itr,        const std::string fatjetName = "fatjet", const std::string suffix = "");
-
-  void FillTruthFatJets( const xAOD::JetContainer* truthFatJets,     const std::string truthFatJetName="truth_fatjet" );
-  void FillTruthFatJet ( const xAOD::Jet*          truth_fatjet_itr, const std::string truthFatJetName="truth_fatjet" );
-
-  void FillTaus( const xAOD::TauJetContainer* taus, const std::string tauName = "tau" );
-  void FillTau ( const xAOD::TauJet* tau,           const std::string tauName = "tau" );
-  void FillMET( const xAOD::MissingETContainer* met, const std::string metName = "met" );
+  void FillFatJets( const xAOD::JetContainer* fatJets , const std::string& fatjetName = "fatjet", const std::string& suffix = "");
+  void FillFatJet ( const xAOD::Jet* fatjet_itr,        const std::string& fatjetName = "fatjet", const std::string& suffix = "");
+  void FillFatJets( xAH::FatJetContainer* fatjetHandle, const xAOD::JetContainer* fatJets );
+  void FillFatJet ( xAH::FatJetContainer* fatjetHandle, const xAOD::Jet* fatjet_itr );
+
+  void FillTruthFatJets( const xAOD::JetContainer* truthFatJets,     const std::string& truthFatJetName="truth_fatjet" );
+  void FillTruthFatJet ( const xAOD::Jet*          truth_fatjet_itr, const std::string& truthFatJetName="truth_fatjet" );
+  void FillTruthFatJets( xAH::FatJetContainer* truthFatJetHandle, const xAOD::JetContainer* truthFatJets );
+  void FillTruthFatJet ( xAH::FatJetContainer* truthFatJetHandle, const xAOD::Jet*          truth_fatjet_itr );
+
+  void FillTaus( const xAOD::TauJetContainer* taus, const std::string& tauName = "tau" );
+  void FillTau ( const xAOD::TauJet* tau,           const std::string& tauName = "tau" );
+  void FillTaus( xAH::TauContainer* tauHandle, const xAOD::TauJetContainer* taus );
+  void FillTau ( xAH::TauContainer* tauHandle, const xAOD::TauJet* tau );
+  void FillMET( const xAOD::MissingETContainer* met, const std::string& metName = "met" );
+  void FillMET( xAH::MetContainer* metHandle, const xAOD::MissingETContainer* met );
 
   void Fill();
+  /** @brief The output tree */
+  TTree* tree() const { return m_tree; }
   void ClearEvent();
   void ClearTrigger();
   void ClearJetTrigger();
-  void ClearMuons       (const std::string jetName = "muon");
-  void ClearElectrons   (const std::string elecName = "el");
-  void ClearPhotons     (const std::string photonName = "ph");
-  void ClearClusters    (const std::string clusterName = "cl");
-  void ClearJets        (const std::string jetName = "jet");
+  void ClearMuons       (const std::string& jetName = "muon");
+  void ClearElectrons   (const std::string& elecName = "el");
+  void ClearPhotons     (const std::string& photonName = "ph");
+  void ClearClusters    (const std::string& clusterName = "cl");
+  void ClearJets        (const std::string& jetName = "jet");
   void ClearL1Jets      ();
-  void ClearTruth       (const std::string truthName);
-  void ClearTracks	(const std::string trackName);
-  void ClearFatJets     (const std::string fatjetName, const std::string suffix="");
-  void ClearTruthFatJets(const std::string truthFatJetName = "truth_fatjet");
-  void ClearTaus        (const std::string tauName = "tau" );
-  void ClearMET         (const std::string metName = "met");
+  void ClearTruth       (const std::string& truthName);
+  void ClearTracks      (const std::string& trackName);
+  void ClearFatJets     (const std::string& fatjetName, const std::string& suffix="");
+  void ClearTruthFatJets(const std::string& truthFatJetName = "truth_fatjet");
+  void ClearTaus        (const std::string& tauName = "tau" );
+  void ClearMET         (const std::string& metName = "met");
+
+  void ClearMuons       (xAH::MuonContainer*     muonHandle);
+  void ClearElectrons   (xAH::ElectronContainer* elecHandle);
+  void ClearPhotons     (xAH::PhotonContainer*   photonHandle);
+  void ClearClusters    (xAH::ClusterContainer*  clusterHandle);
+  void ClearJets        (xAH::JetContainer*      jetHandle);
+  void ClearTruth       (xAH::TruthContainer*    truthHandle);
+  void ClearTracks      (xAH::TrackContainer*    trackHandle);
+  void ClearFatJets     (xAH::FatJetContainer*   fatjetHandle);
+  void ClearTruthFatJets(xAH::FatJetContainer*   truthFatJetHandle);
+  void ClearTaus        (xAH::TauContainer*      tauHandle);
+  void ClearMET         (xAH::MetContainer*      metHandle);
 
   bool writeTo( TFile *file );
 
@@ -277,6 +325,12 @@ public:
   virtual void ClearMETUser         (const std::string /*metName = "met"*/)       { return; };
 
   virtual void FillEventUser    ( const xAOD::EventInfo*  )        { return; };
+
+  /**
+   *  @brief  Per-object user hooks. These are called for every object of a collection, so prefer
+   *          the per-collection hooks below for new code, and return false from
+   *          ``wantsPerObjectHooks`` to skip these calls altogether.
+   */
   virtual void FillMuonsUser    ( const xAOD::Muon*,        const std::string /*muonName = "muon"*/  )             { return; };
   virtual void FillElectronsUser( const xAOD::Electron*,    const std::string /*elecName = "el"*/ )     { return; };
   virtual void FillPhotonsUser  ( const xAOD::Photon*,      const std::string /*photonName = "ph"*/ )     { return; };
@@ -285,7 +339,7 @@ public:
   virtual void FillTruthUser    ( const std::string /*truthName*/, const xAOD::TruthParticle*  )               { return; };
   virtual void FillTracksUser   ( const std::string /*trackName*/, const xAOD::TrackParticle*  )               { return; };
   /**
-   *  @brief  Called once per call to `FillFatJets()`.Ooverride this if you want to any additional
+   *  @brief  Called once per fat jet in `FillFatJets()`. Override this if you want to any additional
    *          information to your jet collection.
    *  @param  jet         a pointer to the current xAOD::Jet object that should be written to the
    *                      output branch(s).
@@ -295,10 +349,36 @@ public:
   virtual void FillFatJetsUser( const xAOD::Jet* /*jet*/, const std::string /*fatjetName = "fatjet"*/, const std::string /*suffix = ""*/) { return; };
   virtual void FillTruthFatJetsUser( const xAOD::Jet* /*jet*/, const std::string /*fatjetName = "truth_fatjet"*/   )            { return; };
   virtual void FillTausUser( const xAOD::TauJet*,           const std::string /*tauName = "tau"*/  )            { return; };
+  /**
+   *  @brief  Whether the per-object ``Fill*User`` hooks above are called. Subclasses that only use
+   *          the per-collection hooks should return false, so no virtual call is made per object.
+   *          Whether a hook is overridden cannot be queried portably, so this is declared rather
+   *          than detected. Checked in the ``Add*`` methods.
+   */
+  virtual bool wantsPerObjectHooks() const { return true; }
   virtual void FillMETUser( const xAOD::MissingETContainer*, const std::string /*metName = "met"*/ ) { return; };
   virtual void FillTriggerUser( const xAOD::EventInfo*  )      { return; };
   virtual void FillJetTriggerUser()                            { return; };
 
+  /**
+   *  @brief  Per-collection user hooks. Called once per call to the matching collection-level
+   *          ``Fill*`` method, after every object has been written to the branch container, so
+   *          the handle holds the complete columns for this event. Use ``handle->name()`` (and
+   *          ``handle->suffix()`` for fat jets) to tell collections apart.
+   *  @param  objects     the input xAOD container that was written out.
+   *  @param  handle      the branch container returned by the matching ``Add*`` call.
+   */
+  virtual void FillMuonCollectionUser       ( const xAOD::MuonContainer*          /*muons*/,     xAH::MuonContainer*     /*handle*/ ) { return; };
+  virtual void FillElectronCollectionUser   ( const xAOD::ElectronContainer*      /*electrons*/, xAH::ElectronContainer* /*handle*/ ) { return; };
+  virtual void FillPhotonCollectionUser     ( const xAOD::PhotonContainer*        /*photons*/,   xAH::PhotonContainer*   /*handle*/ ) { return; };
+  virtual void FillClusterCollectionUser    ( const xAOD::CaloClusterContainer*   /*clusters*/,  xAH::ClusterContainer*  /*handle*/ ) { return; };
+  virtual void FillJetCollectionUser        ( const xAOD::JetContainer*           /*jets*/,      xAH::JetContainer*      /*handle*/ ) { return; };
+  virtual void FillTruthCollectionUser      ( const xAOD::TruthParticleContainer* /*truth*/,     xAH::TruthContainer*    /*handle*/ ) { return; };
+  virtual void FillTrackCollectionUser      ( const xAOD::TrackParticleContainer* /*tracks*/,    xAH::TrackContainer*    /*handle*/ ) { return; };
+  virtual void FillFatJetCollectionUser     ( const xAOD::JetContainer*           /*fatJets*/,   xAH::FatJetContainer*   /*handle*/ ) { return; };
+  virtual void FillTruthFatJetCollectionUser( const xAOD::JetContainer*           /*fatJets*/,   xAH::FatJetContainer*   /*handle*/ ) { return; };
+  virtual void FillTauCollectionUser        ( const xAOD::TauJetContainer*        /*taus*/,      xAH::TauContainer*      /*handle*/ ) { return; };
+
  protected:
 
   template<typename T, typename U, typename V>
@@ -320,6 +400,13 @@ protected:
   bool m_isMC;
   bool m_nominalTree;
 
+  // false when this is a plain HelpTreeBase, i.e. no user hook can be overridden (see setUserHooks)
+  bool m_userHooks;
+  // false when the per-object Fill*User hooks are not wanted either (see setUserHooks)
+  bool m_perObjectUserHooks;
+  /// @brief Set ``m_userHooks`` and ``m_perObjectUserHooks`` from the dynamic type, called by the ``Add*`` methods
+  void setUserHooks();
+
   // event
   xAH::EventInfo*      m_eventInfo;
 
@@ -341,10 +428,43 @@ protected:
   std::vector<std::string>  m_isPassBitsNames;
   std::vector<unsigned int> m_isPassBits;
 
+  // trigger decisions as bitmasks indexed by chain id (see TriggerInfoSwitch::m_passTrigMask)
+  std::vector<std::string>                      m_trigChainNames;
+  std::unordered_map<std::string, unsigned int> m_trigChainIds;
+  TList*                                        m_trigChainList; // "passTrigMaskChains" in the tree's UserInfo, owned by the tree
+  std::vector<ULong64_t> m_passedTriggersMask;
+  std::vector<ULong64_t> m_disabledTriggersMask;
+  std::vector<float>     m_triggerPrescalesById;
+
+  /// @brief Return the id of a trigger chain, registering it in the chain dictionary on first use
+  unsigned int trigChainId( const std::string& chainName );
+
+  /// @brief Round the float branches of every container in ``containers`` to their ``mantissaBits`` precision (see ParticleContainer::quantizeBranches)
+  template<typename T_CONTAINER> void quantizeBranches( const std::map<std::string, T_CONTAINER*>& containers )
+  {
+    for ( const auto& container : containers ) container.second->quantizeBranches();
+  }
+
+  /// @brief Store the systematic names of a flat scale factor branch (see MuonInfoSwitch::m_effSFFlat) from the TStore, once per file
+  template<typename T_CONTAINER> void setFlatSFSysNames( T_CONTAINER* container, const std::string& sfName, const std::string& storeKey )
+  {
+    if ( !container->flatSFSysNames(sfName).empty() || !m_store->contains< std::vector< std::string > >(storeKey) ) return;
+    std::vector< std::string >* sysNames(nullptr);
+    if ( m_store->retrieve(sysNames, storeKey).isSuccess() ) container->setFlatSFSysNames(sfName, *sysNames);
+  }
+
   //
   //  Jets
   //
   std::map<std::string, xAH::JetContainer*> m_jets;
+  // ghost-track PV selection decisions shared by all jet collections of the event
+  xAH::TrackSelectionCache m_trkSelCache;
+  // key of m_trkSelCache, taken from the EventInfo passed to FillEvent and reset by Fill
+  bool               m_trkSelEventKnown;
+  uint32_t           m_trkSelRunNumber;
+  unsigned long long m_trkSelEventNumber;
+  /// @brief Start a new event of ``m_trkSelCache`` if the event given to ``FillEvent`` or ``pv`` changed, or reset it if ``FillEvent`` was not called
+  void newTrackSelectionEvent( const xAOD::Vertex* pv );
 
   //
   // L1 Jets
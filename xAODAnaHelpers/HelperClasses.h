@@ -177,6 +177,7 @@ namespace HelperClasses {
         m_menuKeys       menuKeys       exact
         m_passTriggers   passTriggers   exact
         m_passTrigBits   passTrigBits   exact
+        m_passTrigMask   passTrigMask   exact
         m_prescales      prescales      exact
         m_prescalesLumi  prescalesLumi  exact
         ================ ============== =======
@@ -184,6 +185,9 @@ namespace HelperClasses {
         .. note::
             ``m_prescales`` contains information from the ``TrigDecisionTool`` for every trigger used in event selection and event trigger-matching. ``m_prescalesLumi`` contains information retrieved from the pile-up reweighting tool based on the actual luminosities of triggers.
 
+        .. note::
+            ``m_passTrigMask`` is a compact alternative to ``m_passTriggers``. Each chain is given an id the first time it is seen, and the passed and disabled decisions are written as bitmasks of 64-bit words indexed by chain id. The chain names are stored once, as ``TObjString`` objects in a ``TList`` named ``passTrigMaskChains`` in the output tree's ``UserInfo`` (``tree->GetUserInfo()->FindObject("passTrigMaskChains")``), where the position in that list is the chain id. With ``m_prescales``, the prescales of the passed chains are written as ``triggerPrescalesById``, indexed by chain id, with -1 for chains that did not pass.
+
     @endrst
    */
   class TriggerInfoSwitch : public InfoSwitch {
@@ -192,6 +196,7 @@ namespace HelperClasses {
     bool m_menuKeys;
     bool m_passTriggers;
     bool m_passTrigBits;
+    bool m_passTrigMask;
     bool m_prescales;
     bool m_prescalesLumi;
     TriggerInfoSwitch(const std::string configStr) : InfoSwitch(configStr) { initialize(); };
@@ -242,6 +247,7 @@ namespace HelperClasses {
         Parameter              Pattern              Match
         ====================== ==================== =======
         m_trigger              trigger              exact
+        m_trigMatchMask        trigMatchMask        exact
         m_isolation            isolation            exact
         m_isolationKinematics  isolationKinematics  exact
         m_quality              quality              exact
@@ -249,6 +255,8 @@ namespace HelperClasses {
         m_trackparams          trackparams          exact
         m_trackhitcont         trackhitcont         exact
         m_effSF                effSF                exact
+        m_effSFFlat            effSFFlat            exact
+        m_effSFQuant           effSFQuant           exact
         m_energyLoss           energyLoss           exact
         m_recoWPs[XYZ]         RECO_XYZ             pattern
         m_isolWPs[""]          ISOL_                exact
@@ -271,17 +279,24 @@ namespace HelperClasses {
 
              will define the ``Loose`` isolation working point status branch, and scale factors without isolation requirements and using the ``Loose`` WP.
 
+             ``trigMatchMask`` is a compact alternative to ``trigger``: the trigger matching result of each muon is written as one ``ULong64_t`` (``muon_trigMatchMask``) with one bit per chain. The chain names are written once per file, as a ``TList`` of ``TObjString`` named ``muon_trigMatchChains`` in the output tree's ``UserInfo``; bit ``i`` corresponds to the ``i``-th entry. At most 64 chains are supported.
+
+             ``effSFFlat`` changes the layout of the ``effSF`` branches from ``vector<vector<float>>`` to one flat ``vector<float>`` per scale factor, holding ``nmuon x nsys`` values with a fixed stride: the systematics of muon ``i`` are the entries ``[i*nsys, (i+1)*nsys)``. The systematic names are written once per file, as a ``TList`` of ``TObjString`` named after the branch with a ``_sysNames`` suffix (e.g. ``muon_RecoEff_SF_RecoMedium_sysNames``) in the output tree's ``UserInfo``, instead of the per-event ``*_sysNames`` branches. ``effSFQuant`` additionally rounds the stored scale factors to 16 significant bits, which leaves them well within their uncertainties and makes the branches compress much better.
+
     @endrst
    */
   class MuonInfoSwitch : public IParticleInfoSwitch {
   public:
     bool m_trigger;
+    bool m_trigMatchMask;
     bool m_isolation;
     bool m_isolationKinematics;
     bool m_quality;
     bool m_trackparams;
     bool m_trackhitcont;
     bool m_effSF;
+    bool m_effSFFlat;
+    bool m_effSFQuant;
     bool m_energyLoss;
     bool m_promptlepton;
 
@@ -309,12 +324,15 @@ namespace HelperClasses {
         Parameter             Pattern             Match
         ===================== =================== =======
         m_trigger             trigger             exact
+        m_trigMatchMask       trigMatchMask       exact
         m_isolation           isolation           exact
         m_isolationKinematics isolationKinematics exact
         m_PID                 PID                 exact
         m_trackparams         trackparams         exact
         m_trackhitcont        trackhitcont        exact
         m_effSF               effSF               exact
+        m_effSFFlat           effSFFlat           exact
+        m_effSFQuant          effSFQuant          exact
         m_PIDWPs[XYZ]         PID_XYZ             pattern
         m_PIDSFWPs[XYZ]       PIDSF_XYZ           pattern
         m_isolWPs[""]         ISOL_               exact
@@ -337,11 +355,16 @@ namespace HelperClasses {
 
             will define the ``Loose`` isolation working point status branch, and scale factors without isolation requirements and using the ``Loose`` WP.
 
+            ``trigMatchMask`` writes the trigger matching result as a per-electron bitmask, see :cpp:class:`HelperClasses::MuonInfoSwitch`.
+
+            ``effSFFlat`` and ``effSFQuant`` write the scale factors as flat arrays with the systematic names stored once per file, see :cpp:class:`HelperClasses::MuonInfoSwitch`.
+
     @endrst
    */
   class ElectronInfoSwitch : public IParticleInfoSwitch {
   public:
     bool m_trigger;
+    bool m_trigMatchMask;
     bool m_isolation;
     bool m_isolationKinematics;
     bool m_quality;
@@ -350,6 +373,8 @@ namespace HelperClasses {
     bool m_trackparams;
     bool m_trackhitcont;
     bool m_effSF;
+    bool m_effSFFlat;
+    bool m_effSFQuant;
     bool m_promptlepton;
     std::vector< std::string > m_PIDWPs;
     std::vector< std::string > m_PIDSFWPs;
@@ -407,6 +432,7 @@ namespace HelperClasses {
         ================ ============== =======
         m_kinematic      kinematic      exact
         m_trigger        trigger        exact
+        m_trigMatchMask  trigMatchMask  exact
         m_substructure   substructure   exact
         m_bosonCount     bosonCount     exact
         m_VTags          VTags          exact
@@ -475,11 +501,14 @@ namespace HelperClasses {
 
 	    ``trackJetName`` expects one or more track jet container names separated by an underscore. For example, the string ``trackJetName_GhostAntiKt2TrackJet_GhostVR30Rmax4Rmin02TrackJet`` will set the attriubte ``m_trackJetNames``
 	    to ``{"GhostAntiKt2TrackJet", "GhostVR30Rmax4Rmin02TrackJet"}``.
+
+            ``trigMatchMask`` writes the trigger matching result as a per-jet bitmask, see :cpp:class:`HelperClasses::MuonInfoSwitch`.
     @endrst
    */
   class JetInfoSwitch : public IParticleInfoSwitch {
   public:
     bool m_trigger;
+    bool m_trigMatchMask;
     bool m_substructure;
     bool m_bosonCount;
     bool m_VTags;
@@ -549,8 +578,12 @@ namespace HelperClasses {
         m_bVtx           bVtx           exact
         m_parents        parents        exact
         m_children       children       exact
+        m_flatLinks      flatLinks      exact
         ================ ============== =======
 
+        .. note::
+
+            With ``flatLinks``, ``parents`` and ``children`` are written as positions in the same truth collection instead of copies of the linked particles' ``pdgId``, ``barcode`` and ``status``: the links of particle ``i`` are ``parent_index[parent_begin[i]]`` to ``parent_index[parent_begin[i]+nParents[i]-1]`` (likewise for children), and are -1 for particles that were not written. :cpp:func:`xAH::TruthContainer::FillTruthLinks` has to be called after the particles of an event are filled, which :cpp:class:`HelpTreeBase` does when filling a whole ``xAOD::TruthParticleContainer``, and in ``HelpTreeBase::Fill`` for particles filled one by one.
 
     @endrst
    */
@@ -560,6 +593,7 @@ namespace HelperClasses {
     bool m_bVtx;
     bool m_parents;
     bool m_children;
+    bool m_flatLinks;
     TruthInfoSwitch(const std::string configStr) : IParticleInfoSwitch(configStr) { initialize(); };
   protected:
     void initialize();
@@ -13,6 +13,7 @@
 #include <TH2F.h>
 #include <TH3F.h>
 #include <TProfile.h>
+#include <TDirectory.h>
 #include <EventLoop/IWorker.h>
 #include <xAODRootAccess/TEvent.h>
 
@@ -194,6 +195,21 @@ class HistogramManager {
      */
     void record(EL::IWorker* wk);
 
+    /**
+     * @brief write all histograms from HistogramManager#m_allHists to a directory, creating the sub-directories in their names
+     */
+    void record(TDirectory* dir);
+
+    /**
+     * @brief all histograms booked so far, in booking order
+     */
+    const std::vector< TH1* >& hists() const { return m_allHists; }
+
+    /**
+     * @brief add the histograms of another instance booked the same way, e.g. a clone filled in another thread
+     */
+    StatusCode merge(const HistogramManager& other);
+
     /**
       * @brief the standard message stream for this algorithm
       */
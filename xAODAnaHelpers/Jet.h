@@ -4,6 +4,9 @@
 #include "xAODAnaHelpers/Particle.h"
 #include "xAODAnaHelpers/MuonContainer.h"
 
+#include <bitset>
+#include <utility>
+
 
 namespace xAH {
 
@@ -33,7 +36,29 @@ namespace xAH {
 	MV2c10_FixedCutBEff_30,MV2c10_FixedCutBEff_50,MV2c10_FixedCutBEff_90, // R20.7
 	MV2c10_FixedCutBEff_60,MV2c10_FixedCutBEff_70,MV2c10_FixedCutBEff_77,MV2c10_FixedCutBEff_85,
 	MV2c10_FlatBEff_30,MV2c10_FlatBEff_50,MV2c10_FlatBEff_60,MV2c10_FlatBEff_70,MV2c10_FlatBEff_77,MV2c10_FlatBEff_85, // R20.7
-	MV2c10_HybBEff_60,MV2c10_HybBEff_70,MV2c10_HybBEff_77,MV2c10_HybBEff_85
+	MV2c10_HybBEff_60,MV2c10_HybBEff_70,MV2c10_HybBEff_77,MV2c10_HybBEff_85,
+	NBTaggerOP // number of operating points, keep last
+      };
+
+      /// per-track IP2D/IP3D inputs, only allocated when the ``ipDetails`` switch is read
+      struct IPTrackDetails {
+        std::vector<float> IP2D_gradeOfTracks         ;
+        std::vector<float> IP2D_flagFromV0ofTracks    ;
+        std::vector<float> IP2D_valD0wrtPVofTracks    ;
+        std::vector<float> IP2D_sigD0wrtPVofTracks    ;
+        std::vector<float> IP2D_weightBofTracks       ;
+        std::vector<float> IP2D_weightCofTracks       ;
+        std::vector<float> IP2D_weightUofTracks       ;
+
+        std::vector<float> IP3D_gradeOfTracks      ;
+        std::vector<float> IP3D_flagFromV0ofTracks ;
+        std::vector<float> IP3D_valD0wrtPVofTracks ;
+        std::vector<float> IP3D_sigD0wrtPVofTracks ;
+        std::vector<float> IP3D_valZ0wrtPVofTracks ;
+        std::vector<float> IP3D_sigZ0wrtPVofTracks ;
+        std::vector<float> IP3D_weightBofTracks    ;
+        std::vector<float> IP3D_weightCofTracks    ;
+        std::vector<float> IP3D_weightUofTracks    ;
       };
 
       Jet();
@@ -43,6 +68,7 @@ namespace xAH {
       int               isTrigMatched;
       std::vector<int>  isTrigMatchedToChain;
       std::string       listTrigChains;
+      ULong64_t         trigMatchMask; // bit i set if matched to trigMatchChains()[i] of the container
       
       // clean
       float Timing;
@@ -188,13 +214,6 @@ namespace xAH {
       float IP2D_cu     ;
       float nIP2DTracks ;
     
-      std::vector<float> IP2D_gradeOfTracks         ;
-      std::vector<float> IP2D_flagFromV0ofTracks    ;
-      std::vector<float> IP2D_valD0wrtPVofTracks    ;
-      std::vector<float> IP2D_sigD0wrtPVofTracks    ;
-      std::vector<float> IP2D_weightBofTracks       ;
-      std::vector<float> IP2D_weightCofTracks       ;
-      std::vector<float> IP2D_weightUofTracks       ;
     
       float IP3D_pu     ;
       float IP3D_pb     ;
@@ -203,216 +222,13 @@ namespace xAH {
       float IP3D_cu     ;
       float nIP3DTracks ;
     
-      std::vector<float> IP3D_gradeOfTracks      ;
-      std::vector<float> IP3D_flagFromV0ofTracks ;
-      std::vector<float> IP3D_valD0wrtPVofTracks ;
-      std::vector<float> IP3D_sigD0wrtPVofTracks ;
-      std::vector<float> IP3D_valZ0wrtPVofTracks ;
-      std::vector<float> IP3D_sigZ0wrtPVofTracks ;
-      std::vector<float> IP3D_weightBofTracks    ;
-      std::vector<float> IP3D_weightCofTracks    ;
-      std::vector<float> IP3D_weightUofTracks    ;
 
       // jetBTag
-      int is_DL1rnn_FixedCutBEff_60;
-      std::vector<float> SF_DL1rnn_FixedCutBEff_60;
-      int is_DL1rnn_FixedCutBEff_70;
-      std::vector<float> SF_DL1rnn_FixedCutBEff_70;
-      int is_DL1rnn_FixedCutBEff_77;
-      std::vector<float> SF_DL1rnn_FixedCutBEff_77;
-      int is_DL1rnn_FixedCutBEff_85;
-      std::vector<float> SF_DL1rnn_FixedCutBEff_85;
-
-      int is_DL1rnn_HybBEff_60;
-      std::vector<float> SF_DL1rnn_HybBEff_60;
-      int is_DL1rnn_HybBEff_70;
-      std::vector<float> SF_DL1rnn_HybBEff_70;
-      int is_DL1rnn_HybBEff_77;
-      std::vector<float> SF_DL1rnn_HybBEff_77;
-      int is_DL1rnn_HybBEff_85;
-      std::vector<float> SF_DL1rnn_HybBEff_85;
-
-      int is_DL1mu_FixedCutBEff_60;
-      std::vector<float> SF_DL1mu_FixedCutBEff_60;
-      int is_DL1mu_FixedCutBEff_70;
-      std::vector<float> SF_DL1mu_FixedCutBEff_70;
-      int is_DL1mu_FixedCutBEff_77;
-      std::vector<float> SF_DL1mu_FixedCutBEff_77;
-      int is_DL1mu_FixedCutBEff_85;
-      std::vector<float> SF_DL1mu_FixedCutBEff_85;
-
-      int is_DL1mu_HybBEff_60;
-      std::vector<float> SF_DL1mu_HybBEff_60;
-      int is_DL1mu_HybBEff_70;
-      std::vector<float> SF_DL1mu_HybBEff_70;
-      int is_DL1mu_HybBEff_77;
-      std::vector<float> SF_DL1mu_HybBEff_77;
-      int is_DL1mu_HybBEff_85;
-      std::vector<float> SF_DL1mu_HybBEff_85;
-
-      int is_DL1r_FixedCutBEff_60;
-      std::vector<float> SF_DL1r_FixedCutBEff_60;
-      int is_DL1r_FixedCutBEff_70;
-      std::vector<float> SF_DL1r_FixedCutBEff_70;
-      int is_DL1r_FixedCutBEff_77;
-      std::vector<float> SF_DL1r_FixedCutBEff_77;
-      int is_DL1r_FixedCutBEff_85;
-      std::vector<float> SF_DL1r_FixedCutBEff_85;
-
-      int is_DL1r_HybBEff_60;
-      std::vector<float> SF_DL1r_HybBEff_60;
-      int is_DL1r_HybBEff_70;
-      std::vector<float> SF_DL1r_HybBEff_70;
-      int is_DL1r_HybBEff_77;
-      std::vector<float> SF_DL1r_HybBEff_77;
-      int is_DL1r_HybBEff_85;
-      std::vector<float> SF_DL1r_HybBEff_85;
-
-      int is_DL1rmu_FixedCutBEff_60;
-      std::vector<float> SF_DL1rmu_FixedCutBEff_60;
-      int is_DL1rmu_FixedCutBEff_70;
-      std::vector<float> SF_DL1rmu_FixedCutBEff_70;
-      int is_DL1rmu_FixedCutBEff_77;
-      std::vector<float> SF_DL1rmu_FixedCutBEff_77;
-      int is_DL1rmu_FixedCutBEff_85;
-      std::vector<float> SF_DL1rmu_FixedCutBEff_85;
-
-      int is_DL1rmu_HybBEff_60;
-      std::vector<float> SF_DL1rmu_HybBEff_60;
-      int is_DL1rmu_HybBEff_70;
-      std::vector<float> SF_DL1rmu_HybBEff_70;
-      int is_DL1rmu_HybBEff_77;
-      std::vector<float> SF_DL1rmu_HybBEff_77;
-      int is_DL1rmu_HybBEff_85;
-      std::vector<float> SF_DL1rmu_HybBEff_85;
-
-
-      int is_DL1_FixedCutBEff_60;
-      std::vector<float> SF_DL1_FixedCutBEff_60;
-      int is_DL1_FixedCutBEff_70;
-      std::vector<float> SF_DL1_FixedCutBEff_70;
-      int is_DL1_FixedCutBEff_77;
-      std::vector<float> SF_DL1_FixedCutBEff_77;
-      int is_DL1_FixedCutBEff_85;
-      std::vector<float> SF_DL1_FixedCutBEff_85;
+      std::bitset<NBTaggerOP> btagBits; // bit op set if tagged at operating point op
+      std::vector< std::pair<BTaggerOP, std::vector<float> > > btagSFs; // SFs of the operating points read in
 
-      int is_DL1_HybBEff_60;
-      std::vector<float> SF_DL1_HybBEff_60;
-      int is_DL1_HybBEff_70;
-      std::vector<float> SF_DL1_HybBEff_70;
-      int is_DL1_HybBEff_77;
-      std::vector<float> SF_DL1_HybBEff_77;
-      int is_DL1_HybBEff_85;
-      std::vector<float> SF_DL1_HybBEff_85;
-
-      int is_MV2c10rnn_FixedCutBEff_60;
-      std::vector<float> SF_MV2c10rnn_FixedCutBEff_60;
-      int is_MV2c10rnn_FixedCutBEff_70;
-      std::vector<float> SF_MV2c10rnn_FixedCutBEff_70;
-      int is_MV2c10rnn_FixedCutBEff_77;
-      std::vector<float> SF_MV2c10rnn_FixedCutBEff_77;
-      int is_MV2c10rnn_FixedCutBEff_85;
-      std::vector<float> SF_MV2c10rnn_FixedCutBEff_85;
-
-      int is_MV2c10rnn_HybBEff_60;
-      std::vector<float> SF_MV2c10rnn_HybBEff_60;
-      int is_MV2c10rnn_HybBEff_70;
-      std::vector<float> SF_MV2c10rnn_HybBEff_70;
-      int is_MV2c10rnn_HybBEff_77;
-      std::vector<float> SF_MV2c10rnn_HybBEff_77;
-      int is_MV2c10rnn_HybBEff_85;
-      std::vector<float> SF_MV2c10rnn_HybBEff_85;
-
-      int is_MV2c10mu_FixedCutBEff_60;
-      std::vector<float> SF_MV2c10mu_FixedCutBEff_60;
-      int is_MV2c10mu_FixedCutBEff_70;
-      std::vector<float> SF_MV2c10mu_FixedCutBEff_70;
-      int is_MV2c10mu_FixedCutBEff_77;
-      std::vector<float> SF_MV2c10mu_FixedCutBEff_77;
-      int is_MV2c10mu_FixedCutBEff_85;
-      std::vector<float> SF_MV2c10mu_FixedCutBEff_85;
-
-      int is_MV2c10mu_HybBEff_60;
-      std::vector<float> SF_MV2c10mu_HybBEff_60;
-      int is_MV2c10mu_HybBEff_70;
-      std::vector<float> SF_MV2c10mu_HybBEff_70;
-      int is_MV2c10mu_HybBEff_77;
-      std::vector<float> SF_MV2c10mu_HybBEff_77;
-      int is_MV2c10mu_HybBEff_85;
-      std::vector<float> SF_MV2c10mu_HybBEff_85;
-
-      int is_MV2r_FixedCutBEff_60;
-      std::vector<float> SF_MV2r_FixedCutBEff_60;
-      int is_MV2r_FixedCutBEff_70;
-      std::vector<float> SF_MV2r_FixedCutBEff_70;
-      int is_MV2r_FixedCutBEff_77;
-      std::vector<float> SF_MV2r_FixedCutBEff_77;
-      int is_MV2r_FixedCutBEff_85;
-      std::vector<float> SF_MV2r_FixedCutBEff_85;
-
-      int is_MV2r_HybBEff_60;
-      std::vector<float> SF_MV2r_HybBEff_60;
-      int is_MV2r_HybBEff_70;
-      std::vector<float> SF_MV2r_HybBEff_70;
-      int is_MV2r_HybBEff_77;
-      std::vector<float> SF_MV2r_HybBEff_77;
-      int is_MV2r_HybBEff_85;
-      std::vector<float> SF_MV2r_HybBEff_85;
-
-      int is_MV2rmu_FixedCutBEff_60;
-      std::vector<float> SF_MV2rmu_FixedCutBEff_60;
-      int is_MV2rmu_FixedCutBEff_70;
-      std::vector<float> SF_MV2rmu_FixedCutBEff_70;
-      int is_MV2rmu_FixedCutBEff_77;
-      std::vector<float> SF_MV2rmu_FixedCutBEff_77;
-      int is_MV2rmu_FixedCutBEff_85;
-      std::vector<float> SF_MV2rmu_FixedCutBEff_85;
-
-      int is_MV2rmu_HybBEff_60;
-      std::vector<float> SF_MV2rmu_HybBEff_60;
-      int is_MV2rmu_HybBEff_70;
-      std::vector<float> SF_MV2rmu_HybBEff_70;
-      int is_MV2rmu_HybBEff_77;
-      std::vector<float> SF_MV2rmu_HybBEff_77;
-      int is_MV2rmu_HybBEff_85;
-      std::vector<float> SF_MV2rmu_HybBEff_85;
-
-      int is_MV2c10_FixedCutBEff_30;
-      std::vector<float> SF_MV2c10_FixedCutBEff_30;
-      int is_MV2c10_FixedCutBEff_50;
-      std::vector<float> SF_MV2c10_FixedCutBEff_50;
-      int is_MV2c10_FixedCutBEff_60;
-      std::vector<float> SF_MV2c10_FixedCutBEff_60;
-      int is_MV2c10_FixedCutBEff_70;
-      std::vector<float> SF_MV2c10_FixedCutBEff_70;
-      int is_MV2c10_FixedCutBEff_77;
-      std::vector<float> SF_MV2c10_FixedCutBEff_77;
-      int is_MV2c10_FixedCutBEff_85;
-      std::vector<float> SF_MV2c10_FixedCutBEff_85;
-      int is_MV2c10_FixedCutBEff_90;
-      std::vector<float> SF_MV2c10_FixedCutBEff_90;
-
-      int is_MV2c10_FlatBEff_30;
-      std::vector<float> SF_MV2c10_FlatBEff_30;
-      int is_MV2c10_FlatBEff_50;
-      std::vector<float> SF_MV2c10_FlatBEff_50;
-      int is_MV2c10_FlatBEff_60;
-      std::vector<float> SF_MV2c10_FlatBEff_60;
-      int is_MV2c10_FlatBEff_70;
-      std::vector<float> SF_MV2c10_FlatBEff_70;
-      int is_MV2c10_FlatBEff_77;
-      std::vector<float> SF_MV2c10_FlatBEff_77;
-      int is_MV2c10_FlatBEff_85;
-      std::vector<float> SF_MV2c10_FlatBEff_85;
-
-      int is_MV2c10_HybBEff_60;
-      std::vector<float> SF_MV2c10_HybBEff_60;
-      int is_MV2c10_HybBEff_70;
-      std::vector<float> SF_MV2c10_HybBEff_70;
-      int is_MV2c10_HybBEff_77;
-      std::vector<float> SF_MV2c10_HybBEff_77;
-      int is_MV2c10_HybBEff_85;
-      std::vector<float> SF_MV2c10_HybBEff_85;
+      // ipDetails
+      DetailBlock<IPTrackDetails> ipTracks;
 
       // truth
       int   ConeTruthLabelID;
@@ -433,6 +249,10 @@ namespace xAH {
     public:
       int is_btag(BTaggerOP op) const;
       const std::vector<float>& SF_btag(BTaggerOP op) const;
+      void setBtag(unsigned int iOP, BTaggerOP op, int isTag, const std::vector<float>& sf);
+
+      /// the per-track IP inputs, empty if they were not read
+      const IPTrackDetails& ipTrackDetails() const;
 
       void muonInJetCorrection(const xAH::MuonContainer* muons);
 
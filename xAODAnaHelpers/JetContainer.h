@@ -14,6 +14,7 @@
 
 #include <xAODAnaHelpers/Jet.h>
 #include <xAODAnaHelpers/ParticleContainer.h>
+#include <xAODAnaHelpers/TrackSelectionCache.h>
 
 #include "InDetTrackSelectionTool/InDetTrackSelectionTool.h"
 
@@ -34,12 +35,72 @@ namespace xAH {
 
       virtual void updateParticle(uint idx, Jet& jet);
 
+      /// @brief Share the per-event ghost-track PV selection decisions (``allTrackPVSel``) with other containers, not owned
+      void setTrackSelectionCache(TrackSelectionCache* cache) { m_trkSelCache = cache; }
+
+      /**
+       * Lazy view of one jet (``m_lazy``), with the names of the fields of ``xAH::Jet``.
+       * Each column is looked up once per container and then read by index; other
+       * variables are available through ``get``.
+       */
+      class LazyJet : public LazyParticle
+      {
+      public:
+	LazyJet(JetContainer* container, uint idx) : LazyParticle(container, idx), m_jets(container) {}
+
+	float     rapidity() const { return get(m_jets->m_lazy_rapidity); }
+	float     Timing() const { return get(m_jets->m_lazy_Timing); }
+	float     LArQuality() const { return get(m_jets->m_lazy_LArQuality); }
+	float     HECQuality() const { return get(m_jets->m_lazy_HECQuality); }
+	float     NegativeE() const { return get(m_jets->m_lazy_NegativeE); }
+	float     N90Constituents() const { return get(m_jets->m_lazy_N90Constituents); }
+	int       clean_passLooseBad() const { return get(m_jets->m_lazy_clean_passLooseBad); }
+	float     EMFrac() const { return get(m_jets->m_lazy_EMFrac); }
+	float     HECFrac() const { return get(m_jets->m_lazy_HECFrac); }
+	float     GhostMuonSegmentCount() const { return get(m_jets->m_lazy_GhostMuonSegmentCount); }
+	float     Jvt() const { return get(m_jets->m_lazy_Jvt); }
+	float     JvtJvfcorr() const { return get(m_jets->m_lazy_JvtJvfcorr); }
+	float     JvtRpt() const { return get(m_jets->m_lazy_JvtRpt); }
+	float     MV2c10() const { return get(m_jets->m_lazy_MV2c10); }
+	float     DL1r() const { return get(m_jets->m_lazy_DL1r); }
+	int       HadronConeExclTruthLabelID() const { return get(m_jets->m_lazy_HadronConeExclTruthLabelID); }
+	int       PartonTruthLabelID() const { return get(m_jets->m_lazy_PartonTruthLabelID); }
+	ULong64_t trigMatchMask() const { return get(m_jets->m_lazy_trigMatchMask); }
+
+      private:
+	JetContainer* m_jets;
+      };
+
+      LazyJet view(uint idx)
+      { return LazyJet(this, idx); }
+
 //template<typename T>
 //  void setBranch(TTree* tree, std::string varName, std::vector<T>* localVectorPtr);
 
     private:
 
       InDet::InDetTrackSelectionTool * m_trkSelTool;
+      TrackSelectionCache            * m_trkSelCache;
+
+      // columns of LazyJet
+      ColumnHandle<float>     m_lazy_rapidity                  {this, "rapidity"};
+      ColumnHandle<float>     m_lazy_Timing                    {this, "Timing"};
+      ColumnHandle<float>     m_lazy_LArQuality                {this, "LArQuality"};
+      ColumnHandle<float>     m_lazy_HECQuality                {this, "HECQuality"};
+      ColumnHandle<float>     m_lazy_NegativeE                 {this, "NegativeE"};
+      ColumnHandle<float>     m_lazy_N90Constituents           {this, "N90Constituents"};
+      ColumnHandle<int>       m_lazy_clean_passLooseBad        {this, "clean_passLooseBad"};
+      ColumnHandle<float>     m_lazy_EMFrac                    {this, "EMFrac"};
+      ColumnHandle<float>     m_lazy_HECFrac                   {this, "HECFrac"};
+      ColumnHandle<float>     m_lazy_GhostMuonSegmentCount     {this, "GhostMuonSegmentCount"};
+      ColumnHandle<float>     m_lazy_Jvt                       {this, "Jvt"};
+      ColumnHandle<float>     m_lazy_JvtJvfcorr                {this, "JvtJvfcorr"};
+      ColumnHandle<float>     m_lazy_JvtRpt                    {this, "JvtRpt"};
+      ColumnHandle<float>     m_lazy_MV2c10                    {this, "MV2c10"};
+      ColumnHandle<float>     m_lazy_DL1r                      {this, "DL1r"};
+      ColumnHandle<int>       m_lazy_HadronConeExclTruthLabelID{this, "HadronConeExclTruthLabelID"};
+      ColumnHandle<int>       m_lazy_PartonTruthLabelID        {this, "PartonTruthLabelID"};
+      ColumnHandle<ULong64_t> m_lazy_trigMatchMask             {this, "trigMatchMask"};
 
       //
       // Vector branches
@@ -319,7 +380,7 @@ namespace xAH {
         std::vector< std::vector<float> >* m_sf;
 
         btagOpPoint(bool mc, const std::string& accessorName)
-	  : m_mc(mc), m_accessorName(accessorName),m_old(true) {
+	  : m_mc(mc), m_accessorName(accessorName),m_op(Jet::BTaggerOP::None),m_old(true) {
           m_isTag = new std::vector<int>();
           m_sf    = new std::vector< std::vector<float> >();
 
@@ -360,7 +421,7 @@ namespace xAH {
         }
 
         btagOpPoint(bool mc, const std::string& tagger, const std::string& wp)
-	  : m_mc(mc), m_accessorName(tagger+"_"+wp),m_old(false) {
+	  : m_mc(mc), m_accessorName(tagger+"_"+wp),m_op(Jet::BTaggerOP::None),m_old(false) {
           m_isTag     = new std::vector<int>();
           m_sf        = new std::vector< std::vector<float> >();
 
@@ -22,6 +22,7 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
 
 // external tools include(s):
 #include "AsgTools/AnaToolHandle.h"
@@ -262,6 +263,7 @@ private:
   /* object-level cutflow */
 
   TH1D* m_jet_cutflowHist_1 = nullptr;  //!
+  xAH::CutflowCounter m_jet_cutflowCounter_1; //!
 
   int   m_jet_cutflow_all;           //!
   int   m_jet_cutflow_cleaning_cut;  //!
@@ -12,6 +12,11 @@
 #include <xAODCutFlow/CutBookkeeperContainer.h>
 #include <xAODCutFlow/CutBookkeeperAuxContainer.h>
 
+#include <map>
+#include <memory>
+
+class MinixAODCopier;
+
 /**
   @brief Produce xAOD outputs
   @rst
@@ -144,6 +149,34 @@ public:
    */
   std::string m_vectorCopyKeys = "";
 
+  /**
+    @brief number of threads making the deep copies of :cpp:member:`MinixAOD::m_deepCopyKeys` in parallel, one container per thread; 1 copies them on the event loop thread
+    @rst
+      All auxiliary variables of the containers the copied objects live in (the input containers of view and shallow copies included) are read on the event loop thread first, as reading them from the input file is not thread-safe. This calls ``ROOT::EnableThreadSafety()``, which holds for the whole job.
+    @endrst
+   */
+  unsigned int m_deepCopyThreads = 1;
+
+  /**
+    @brief number of threads of ROOT's implicit multi-threading, which compresses the output baskets off the event loop thread; 0 leaves it off
+    @rst
+      .. warning:: Implicit multi-threading is a setting of the whole process, not of this algorithm: once enabled it also applies to the trees of every other algorithm in the job (e.g. the ntuples of :cpp:class:`TreeAlgo`) and to the reading of the input trees. Set it on one MinixAOD instance only.
+    @endrst
+   */
+  unsigned int m_compressionThreads = 0;
+
+  /**
+    @brief auxiliary variables to write for the output containers, all of them by default
+    @rst
+      Always specify your string in a space-delimited format where pairs are split up by ``container name|variables``. The variables are separated by ``.`` and may contain the wildcards ``*`` and ``?``. Variables starting with ``-`` are dropped, and a list made only of those keeps all other variables::
+
+          "m_auxItems": "AntiKt4EMTopoJets|pt.eta.phi.m.Jvt* Muons|-passSel*.-*_overlap"
+
+      This applies to any of the simple-copied, deep-copied, shallow-copied or vector-copied containers written to the output, from their first write on. Lists without wildcards are passed to ``TEvent`` as they are. Wildcards are resolved once, before the first write of the container, against every aux variable known to the job at that point: variables created only in later events are not matched, so an allowlist drops them and a denylist keeps them.
+    @endrst
+   */
+  std::string m_auxItems = "";
+
 private:
   /// A vector of containers that are in TEvent that just need to be written to the output
   std::vector<std::string> m_simpleCopyKeys_vec; //!
@@ -157,6 +190,17 @@ private:
   /// A vector of containers (and aux-pairs) in TStore to record in TEvent
   std::vector<std::string> m_copyFromStoreToEventKeys_vec; //!
 
+  /// The aux variable patterns of each container in m_auxItems, removed once applied to the output
+  std::map<std::string, std::vector<std::string> > m_auxItems_map; //!
+
+  /// Set the m_auxItems patterns of ``key`` as its output aux item list, resolving wildcards against the aux type registry; a no-op after the first call
+  EL::StatusCode setAuxItems(const std::string& key);
+
+  /// The typed deep-copier of each entry of m_deepCopyKeys_vec, resolved at the first event
+  std::vector<std::shared_ptr<MinixAODCopier> > m_deepCopiers; //!
+  /// The typed copier recording each TStore container into TEvent, resolved the first time the key is seen
+  std::map<std::string, std::shared_ptr<MinixAODCopier> > m_outputCopiers; //!
+
   /// Pointer for the File MetaData Tool
   xAODMaker::FileMetaDataTool          *m_fileMetaDataTool = nullptr;    //!
   /// Pointer for the TriggerMenu MetaData Tool
@@ -24,6 +24,7 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
 
 // forward-declare for now until IsolationSelectionTool interface is updated
 namespace CP {
@@ -122,7 +123,9 @@ private:
 
   // object cutflow
   TH1D* m_mu_cutflowHist_1 = nullptr;                 //!
+  xAH::CutflowCounter m_mu_cutflowCounter_1; //!
   TH1D* m_mu_cutflowHist_2 = nullptr;                 //!
+  xAH::CutflowCounter m_mu_cutflowCounter_2; //!
 
   int   m_mu_cutflow_all;		    //!
   int   m_mu_cutflow_eta_and_quaility_cut;  //!
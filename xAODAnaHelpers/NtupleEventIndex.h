@@ -0,0 +1,76 @@
+#ifndef xAODAnaHelpers_NtupleEventIndex_H
+#define xAODAnaHelpers_NtupleEventIndex_H
+
+/** @file NtupleEventIndex.h
+ *  @brief Sorted (runNumber, eventNumber) index of the trees written by TreeAlgo
+ *  @author See AUTHORS.md
+ */
+
+#include <TDirectory.h>
+#include <TTree.h>
+
+#include <string>
+#include <vector>
+
+/**
+    @brief Maps (runNumber, eventNumber) to the entries of the trees in one output directory
+    @rst
+        :cpp:class:`TreeAlgo` with ``m_writeEventIndex`` adds one entry per filled event and tree, and writes the index, sorted by run and event number, as the ``eventIndex`` tree next to the trees it belongs to. The tree names are kept in the ``UserInfo`` of the index tree.
+
+        The entries are those of the job's own output. So that the index stays valid after the outputs of several jobs are merged with ``hadd`` (which concatenates the ``eventIndex`` trees like all others), every job also writes one entry to the ``eventIndexBlocks`` tree, with its number of index entries and the names and sizes of its trees. ``read`` walks these blocks to shift the entries of each job by the size of the trees of the jobs merged before it, and sorts the result. Files written without the blocks tree cannot be told apart from merged ones, so they are only read correctly if they were not merged.
+
+        Reading it back loads the index into memory, after which the entry of an event is found by binary search instead of a scan over the tree::
+
+            TFile* file = TFile::Open("tree.root");
+            TDirectory* dir = file->GetDirectory("TreeAlgo");
+            NtupleEventIndex index;
+            if( !index.read(dir) ) return;
+            TTree* nominal = static_cast<TTree*>(dir->Get("nominal"));
+            if( index.load(nominal, 284500, 123456789) < 0 ) std::cout << "event not in the tree" << std::endl;
+
+    @endrst
+ */
+class NtupleEventIndex {
+  public:
+    NtupleEventIndex();
+
+    /** @brief Record that event (``run``, ``event``) is entry ``entry`` of ``treeName`` */
+    void add(const std::string& treeName, UInt_t run, ULong64_t event, Long64_t entry);
+
+    /** @brief Sort the index and write it as the ``eventIndex`` tree into ``dir`` */
+    void write(TDirectory* dir);
+
+    /** @brief Load the ``eventIndex`` tree of ``dir``, re-based per job if the file was merged; false if there is none or it does not match its blocks */
+    bool read(TDirectory* dir);
+
+    /** @brief The entry of (``run``, ``event``) in ``treeName``, -1 if it is not in the tree */
+    Long64_t entry(const std::string& treeName, UInt_t run, ULong64_t event) const;
+
+    /** @brief Read (``run``, ``event``) from ``tree``, looked up by the tree's name; returns the entry or -1 */
+    Long64_t load(TTree* tree, UInt_t run, ULong64_t event) const;
+
+    /** @brief Number of (event, tree) entries in the index */
+    size_t size() const { return m_entries.size(); }
+
+    static const char* treeName() { return "eventIndex"; }
+    static const char* blocksTreeName() { return "eventIndexBlocks"; }
+
+  private:
+    struct Entry {
+      UInt_t    run;
+      UShort_t  tree;
+      ULong64_t event;
+      Long64_t  entry;
+    };
+
+    static bool lessThan(const Entry& a, const Entry& b);
+
+    int treeId(const std::string& treeName) const;
+    int addTree(const std::string& treeName);
+
+    std::vector<std::string> m_trees;
+    std::vector<Entry>       m_entries;
+    bool                     m_sorted;
+};
+
+#endif
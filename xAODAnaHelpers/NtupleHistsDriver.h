@@ -0,0 +1,100 @@
+#ifndef xAODAnaHelpers_NtupleHistsDriver_H
+#define xAODAnaHelpers_NtupleHistsDriver_H
+
+/** @file NtupleHistsDriver.h
+ *  @brief Fill histograms from xAH ntuples in parallel
+ *  @author See AUTHORS.md
+ */
+
+#include <TTree.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "xAODAnaHelpers/HistogramManager.h"
+
+/**
+    @brief One thread's reader and histograms, implemented by the user for :cpp:class:`NtupleHistsDriver`.
+    @rst
+        A worker owns its ntuple readers (:cpp:class:`xAH::EventInfo`, :cpp:class:`xAH::JetContainer`, ...) and its histogram sets (:cpp:class:`JetHists`, ...), so nothing is shared between threads::
+
+            class MyWorker : public NtupleHistsWorker
+            {
+              public:
+                StatusCode initialize(TTree* tree) {
+                  m_jets.setTree(tree);
+                  ANA_CHECK( m_jetHists.initialize() );
+                  return StatusCode::SUCCESS;
+                }
+                StatusCode execute() {
+                  m_jets.updateEntry();
+                  for(const xAH::Jet& jet : m_jets.particles())
+                    ANA_CHECK( m_jetHists.execute(&jet, 1.) );
+                  return StatusCode::SUCCESS;
+                }
+                std::vector<HistogramManager*> histograms() { return {&m_jetHists}; }
+              private:
+                xAH::JetContainer m_jets{"jet", "kinematic"};
+                JetHists m_jetHists{"jets/", "kinematic"};
+            };
+
+    @endrst
+ */
+class NtupleHistsWorker {
+  public:
+    virtual ~NtupleHistsWorker() {}
+
+    /** @brief Connect the readers to this thread's tree and book the histograms */
+    virtual StatusCode initialize(TTree* tree) = 0;
+    /** @brief Fill the histograms, called after each ``GetEntry`` of the worker's range */
+    virtual StatusCode execute() = 0;
+    /** @brief The histogram sets of the worker; the sets of all workers are merged by position */
+    virtual std::vector<HistogramManager*> histograms() = 0;
+};
+
+/**
+    @brief Run :cpp:class:`NtupleHistsWorker` instances over the entries of an ntuple in parallel
+    @rst
+        The entries are split into one contiguous range per thread. Each thread opens its own ``TChain``, creates its own worker with the factory and fills that worker's histograms; at the end the histograms of all workers are added to those of the first one::
+
+            NtupleHistsDriver driver("nominal", {"tree1.root", "tree2.root"});
+            ANA_CHECK( driver.run( [](){ return std::unique_ptr<NtupleHistsWorker>(new MyWorker()); } ) );
+            for(HistogramManager* hists : driver.histograms()) hists->record(outFile);
+
+    @endrst
+ */
+class NtupleHistsDriver {
+  public:
+    typedef std::function< std::unique_ptr<NtupleHistsWorker>() > WorkerFactory;
+
+    /**
+        @param treeName  name of the ntuple tree in each file
+        @param fileNames input files
+        @param nThreads  number of threads, 0 uses the number of cores
+     */
+    NtupleHistsDriver(const std::string& treeName, const std::vector<std::string>& fileNames, unsigned int nThreads = 0);
+    ~NtupleHistsDriver();
+
+    /** @brief Process all entries and merge the histograms */
+    StatusCode run(const WorkerFactory& factory);
+
+    /** @brief The merged histogram sets, valid after ``run`` */
+    std::vector<HistogramManager*> histograms();
+
+    /** @brief the standard message stream for the driver */
+    MsgStream& msg () const;
+    MsgStream& msg (int level) const;
+
+  private:
+    std::string              m_treeName;
+    std::vector<std::string> m_fileNames;
+    unsigned int             m_nThreads;
+
+    std::vector< std::unique_ptr<NtupleHistsWorker> > m_workers;
+
+    mutable MsgStream m_msg;
+};
+
+#endif
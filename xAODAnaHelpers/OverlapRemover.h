@@ -25,6 +25,7 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
 
 // ROOT include(s):
 #include "TH1D.h"
@@ -216,14 +217,19 @@ class OverlapRemover : public xAH::Algorithm
 
   /**  @brief Pointer to the histogram for the electron cutflow */
   TH1D* m_el_cutflowHist_1 = nullptr;    //!
+  xAH::CutflowCounter m_el_cutflowCounter_1; //!
   /**  @brief Pointer to the histogram for the muon cutflow */
   TH1D* m_mu_cutflowHist_1 = nullptr;    //!
+  xAH::CutflowCounter m_mu_cutflowCounter_1; //!
   /**  @brief Pointer to the histogram for the jet cutflow */
   TH1D* m_jet_cutflowHist_1 = nullptr;   //!
+  xAH::CutflowCounter m_jet_cutflowCounter_1; //!
   /**  @brief Pointer to the histogram for the photon cutflow */
   TH1D* m_ph_cutflowHist_1 = nullptr;    //!
+  xAH::CutflowCounter m_ph_cutflowCounter_1; //!
   /**  @brief Pointer to the histogram for the tau cutflow */
   TH1D* m_tau_cutflowHist_1 = nullptr;   //!
+  xAH::CutflowCounter m_tau_cutflowCounter_1; //!
 
   int m_el_cutflow_OR_cut;     //!
   int m_mu_cutflow_OR_cut;     //!
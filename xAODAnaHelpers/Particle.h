@@ -3,7 +3,43 @@
 
 #include <TLorentzVector.h>
 
+#include <memory>
+
 namespace xAH {
+
+  /**
+   * Optional block of particle details, allocated on first use so that
+   * particles read without the corresponding detail string stay small.
+   * Copying a particle copies the block.
+   */
+  template<typename T>
+  class DetailBlock
+  {
+  public:
+    DetailBlock() {}
+    DetailBlock(const DetailBlock& other) : m_block(other.m_block ? new T(*other.m_block) : nullptr) {}
+    DetailBlock(DetailBlock&& other) = default;
+    DetailBlock& operator=(const DetailBlock& other)
+    {
+      if( this != &other ) m_block.reset(other.m_block ? new T(*other.m_block) : nullptr);
+      return *this;
+    }
+    DetailBlock& operator=(DetailBlock&& other) = default;
+
+    /// the block, allocated if needed
+    T& fill()
+    {
+      if( !m_block ) m_block.reset(new T());
+      return *m_block;
+    }
+
+    const T* get() const { return m_block.get(); }
+    const T* operator->() const { return m_block.get(); }
+    explicit operator bool() const { return static_cast<bool>(m_block); }
+
+  private:
+    std::unique_ptr<T> m_block;
+  };
   
   class Particle
   {
@@ -3,9 +3,21 @@
 
 #include <TTree.h>
 #include <TLorentzVector.h>
+#include <TList.h>
+#include <TObjString.h>
 
 #include <vector>
 #include <string>
+#include <map>
+#include <unordered_map>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <sstream>
+#include <cstdlib>
+#include <stdexcept>
 
 #include <xAODAnaHelpers/HelperClasses.h>
 #include <xAODAnaHelpers/HelperFunctions.h>
@@ -31,6 +43,10 @@ namespace xAH
 	m_infoSwitch(detailStr),
 	m_mc(mc),
 	m_debug(false),
+	m_lazy(false),
+	m_treeCacheSize(0),
+	m_treeCacheLearnEntries(100),
+	m_mantissaBits(0),
 	m_units(units),
 	m_storeSystSFs(storeSystSFs),
 	m_useMass(useMass),
@@ -38,6 +54,26 @@ namespace xAH
       {
 	m_n = 0;
 
+	m_trigMatchMask = nullptr;
+	m_trigMatchChainList = nullptr;
+	m_infoTree = nullptr;
+	m_infoTreeNumber = -1;
+	m_readTrigMatchChains = false;
+	m_lazyTree = nullptr;
+	m_lazyEntries = 0;
+	m_soaDerived = 0;
+
+	// "mantissaBitsNN" applies to all float branches, "mantissaBitsNN_var" only to var
+	std::istringstream details(detailStr);
+	std::string detail;
+	while(std::getline(details, detail, ' ')) {
+	  if(detail.compare(0, 12, "mantissaBits") != 0) continue;
+	  std::size_t split = detail.find('_');
+	  int bits = std::atoi(detail.substr(12, split == std::string::npos ? std::string::npos : split-12).c_str());
+	  if(split == std::string::npos) m_mantissaBits = bits;
+	  else                           m_varMantissaBits[detail.substr(split+1)] = bits;
+	}
+
         // kinematic
         m_pt  =new std::vector<float>();
         m_eta =new std::vector<float>();
@@ -56,10 +92,15 @@ namespace xAH
 	  delete m_E;
 	  delete m_M;
 	}
+
+	if(m_trigMatchMask) delete m_trigMatchMask;
+	for(auto& sf : m_flatSFs) delete sf.second.values;
+	for(auto& column : m_lazyColumns) delete column.second;
       }
 
       virtual void setTree(TTree *tree)
       {
+	m_flatSFOrder.clear();
 
 	std::string                   counterName = "n"+m_name;
 	if (!m_suffix.empty())        counterName += "_" + m_suffix;
@@ -70,6 +111,30 @@ namespace xAH
 	tree->SetBranchStatus  (counterName.c_str() , 1);
 	tree->SetBranchAddress (counterName.c_str() , &m_n);
 
+	// the cache learns the branches read during the first entries and prefetches only those
+	if(m_treeCacheSize > 0) {
+	  tree->SetCacheSize(m_treeCacheSize);
+	  tree->SetCacheLearnEntries(m_treeCacheLearnEntries);
+	}
+
+	if(m_lazy) {
+	  // everything but the counter is read on first use, see column()
+	  m_lazyTree = tree;
+	  m_lazyEntries = 0;
+	  m_useMass  = tree->GetBranch(branchName("m").c_str())!=0;
+	  std::string prefix = m_name + "_";
+	  std::string suffix = m_suffix.empty() ? "" : "_" + m_suffix;
+	  for(const TObject* branch : *tree->GetListOfBranches()) {
+	    std::string name = branch->GetName();
+	    if(name.compare(0, prefix.size(), prefix) != 0) continue;
+	    if(name.size() < suffix.size() || name.compare(name.size()-suffix.size(), suffix.size(), suffix) != 0) continue;
+	    tree->SetBranchStatus(name.c_str(), 0);
+	  }
+	  // columns already in use follow the new tree
+	  for(auto& column : m_lazyColumns) column.second->connect(tree, branchName(column.first));
+	  return;
+	}
+
         if(m_infoSwitch.m_kinematic)
           {
 	    // Determine whether mass or energy is saved
@@ -86,6 +151,7 @@ namespace xAH
 
       virtual void setBranches(TTree *tree)
       {
+	m_flatSFOrder.clear();
 
 	std::string              counterName = "n"+m_name;
 	if (!m_suffix.empty()) { counterName += "_" + m_suffix; }
@@ -114,6 +180,23 @@ namespace xAH
 	}
       }
 
+      /**
+       * @brief Round the reduced precision float branches of the current entry, call before ``TTree::Fill``
+       * @rst
+       *     The precision is set in the detail string: ``mantissaBitsNN`` keeps ``NN`` of the 23 mantissa bits of every float branch of the container, ``mantissaBitsNN_var`` only those of the variable ``var`` (e.g. ``mantissaBits10_phi``) and takes precedence. With 10 bits the relative precision is about 5e-4. :cpp:class:`HelpTreeBase` calls this for all its containers in ``Fill``.
+       * @endrst
+       */
+      virtual void quantizeBranches()
+      {
+	for(const QuantizedBranch& branch : m_quantizedBranches) {
+	  if(branch.values)
+	    for(float& value : *branch.values) value = truncateMantissa(value, branch.mantissaBits);
+	  if(branch.nestedValues)
+	    for(std::vector<float>& values : *branch.nestedValues)
+	      for(float& value : values) value = truncateMantissa(value, branch.mantissaBits);
+	}
+      }
+
       virtual void FillParticle(const xAOD::IParticle* particle)
       {
 	m_n++;
@@ -129,26 +212,216 @@ namespace xAH
 
       void updateEntry()
       {
+	m_soaDerived = 0;
+
+	// the chain and systematic names are stored per file, a TChain may have moved to the next one
+	if(m_infoTree && m_infoTree->GetTreeNumber() != m_infoTreeNumber) readUserInfo();
+
+	if(m_lazy) {
+	  // the columns used in the learning window are the only enabled branches of
+	  // this container, stop learning so that later entries prefetch just those
+	  if(++m_lazyEntries == m_treeCacheLearnEntries && m_treeCacheSize > 0 && m_lazyTree) {
+	    m_lazyTree->StopCacheLearningPhase();
+	    if(m_debug) {
+	      std::cout << "Branches of " << m_name << " in use after " << m_lazyEntries << " entries:";
+	      for(const auto& column : m_lazyColumns) std::cout << " " << branchName(column.first);
+	      std::cout << std::endl;
+	    }
+	  }
+	  return;
+	}
+
         m_particles.resize(m_n);
 
         for(int i=0;i<m_n;i++)
 	  updateParticle(i,m_particles[i]);
       }
       
+      /**
+       * Objects of the current entry. Not filled in lazy mode (``m_lazy``), where these
+       * accessors throw; use ``view``, ``column`` or the kinematic vectors instead.
+       */
       std::vector<T_PARTICLE>& particles()
-      { return m_particles; }
+      { checkNotLazy("particles"); return m_particles; }
 
       T_PARTICLE& at_nonConst(uint idx)
-      { return m_particles[idx]; }
+      { checkNotLazy("at_nonConst"); return m_particles[idx]; }
 
       const T_PARTICLE& at(uint idx) const
-      { return m_particles[idx]; }
+      { checkNotLazy("at"); return m_particles[idx]; }
 
       const T_PARTICLE& operator[](uint idx) const
-      { return m_particles[idx]; }
+      { checkNotLazy("operator[]"); return m_particles[idx]; }
 
       uint size() const
-      { return m_particles.size(); }
+      { return m_lazy ? m_n : m_particles.size(); }
+
+      const std::string& name() const
+      { return m_name; }
+
+      const std::string& suffix() const
+      { return m_suffix; }
+
+      /**
+       * Branch buffer of a variable in lazy mode (``m_lazy``), indexed by object. The
+       * branch is enabled and read on the first call, so only the variables used are
+       * decompressed. Hold the reference in loops, the lookup is by name.
+       */
+      template<typename T> const std::vector<T>& column(const std::string& varName)
+      {
+	auto column = m_lazyColumns.find(varName);
+	if(column == m_lazyColumns.end())
+	  column = m_lazyColumns.emplace(varName, connectLazyColumn<T>(varName)).first;
+
+	LazyColumn<T>* typedColumn = dynamic_cast<LazyColumn<T>*>(column->second);
+	if(!typedColumn) {
+	  std::cerr << "ERROR! Branch " << branchName(varName) << " was already read with a different type." << std::endl;
+	  static const std::vector<T> empty;
+	  return empty;
+	}
+	return *typedColumn->values;
+      }
+
+      /**
+       * Branch buffer of a variable in lazy mode, looked up by name on the first access
+       * only. Keep one per container and variable (e.g. as a member) for per-object
+       * access, instead of calling ``column`` for every object.
+       */
+      template<typename T> class ColumnHandle
+      {
+      public:
+	ColumnHandle(ParticleContainer* container, const std::string& varName) : m_container(container), m_varName(varName), m_values(nullptr) {}
+
+	const std::vector<T>& values()
+	{
+	  if(!m_values) m_values = &m_container->template column<T>(m_varName);
+	  return *m_values;
+	}
+
+	// throws std::out_of_range for a branch missing from the file, whose buffer stays empty
+	const T& operator[](uint idx) { return values().at(idx); }
+
+      private:
+	ParticleContainer*    m_container;
+	std::string           m_varName;
+	const std::vector<T>* m_values;
+      };
+
+      /**
+       * Lazy view of one object, reading its fields from the branch buffers on access
+       * instead of copying all of them into a ``T_PARTICLE``. The kinematics go through
+       * the container's column handles; ``get`` looks the variable up by name on every
+       * call, so use a ``ColumnHandle`` for variables read for every object.
+       */
+      class LazyParticle
+      {
+      public:
+	LazyParticle(ParticleContainer* container, uint idx) : m_container(container), m_idx(idx) {}
+
+	template<typename T> const T& get(const std::string& varName) const
+	{ return m_container->template column<T>(varName).at(m_idx); }
+
+	template<typename T> const T& get(ColumnHandle<T>& column) const
+	{ return column[m_idx]; }
+
+	float pt () const { return get(m_container->m_lazyPt ); }
+	float eta() const { return get(m_container->m_lazyEta); }
+	float phi() const { return get(m_container->m_lazyPhi); }
+
+	TLorentzVector p4() const
+	{
+	  TLorentzVector p4;
+	  if(m_container->m_useMass) p4.SetPtEtaPhiM(pt(), eta(), phi(), get(m_container->m_lazyM));
+	  else                       p4.SetPtEtaPhiE(pt(), eta(), phi(), get(m_container->m_lazyE));
+	  return p4;
+	}
+
+      protected:
+	ParticleContainer* m_container;
+	uint               m_idx;
+      };
+
+      LazyParticle view(uint idx)
+      { return LazyParticle(this, idx); }
+
+      /**
+       * Structure-of-arrays access to the kinematics of the current entry, valid after
+       * ``updateEntry``. ``pt``, ``eta``, ``phi`` and the stored one of ``m``/``e`` are
+       * the branch buffers themselves; the other one and ``px``, ``py``, ``pz`` are
+       * computed for all objects at once on first use in the entry. Plain loops over
+       * these vectors vectorize, unlike loops over ``particles()``.
+       */
+      const std::vector<float>& pt () { return kinematic(m_lazyPt , m_pt ); }
+      const std::vector<float>& eta() { return kinematic(m_lazyEta, m_eta); }
+      const std::vector<float>& phi() { return kinematic(m_lazyPhi, m_phi); }
+
+      const std::vector<float>& m()
+      {
+	if(m_useMass) return kinematic(m_lazyM, m_M);
+	if(!(m_soaDerived & SoAMass)) {
+	  const std::vector<float>& pt = this->pt(); const std::vector<float>& eta = this->eta(); const std::vector<float>& e = kinematic(m_lazyE, m_E);
+	  std::size_t n = std::min(pt.size(), e.size());
+	  m_soaM.resize(n);
+	  for(std::size_t i = 0; i < n; i++) {
+	    float p = pt[i]*std::cosh(eta[i]);
+	    m_soaM[i] = std::sqrt(std::max(e[i]*e[i] - p*p, 0.f));
+	  }
+	  m_soaDerived |= SoAMass;
+	}
+	return m_soaM;
+      }
+
+      const std::vector<float>& e()
+      {
+	if(!m_useMass) return kinematic(m_lazyE, m_E);
+	if(!(m_soaDerived & SoAEnergy)) {
+	  const std::vector<float>& pt = this->pt(); const std::vector<float>& eta = this->eta(); const std::vector<float>& m = kinematic(m_lazyM, m_M);
+	  std::size_t n = std::min(pt.size(), m.size());
+	  m_soaE.resize(n);
+	  for(std::size_t i = 0; i < n; i++) {
+	    float p = pt[i]*std::cosh(eta[i]);
+	    m_soaE[i] = std::sqrt(m[i]*m[i] + p*p);
+	  }
+	  m_soaDerived |= SoAEnergy;
+	}
+	return m_soaE;
+      }
+
+      const std::vector<float>& px() { updateMomenta(); return m_soaPx; }
+      const std::vector<float>& py() { updateMomenta(); return m_soaPy; }
+      const std::vector<float>& pz() { updateMomenta(); return m_soaPz; }
+
+      /**
+       * Chain names of the trigger-match bitmask, bit ``i`` of ``trigMatchMask``
+       * corresponds to ``trigMatchChains()[i]``. Filled by ``setTree`` when reading, and
+       * again by ``updateEntry`` for each new file of a ``TChain``, as the bits of
+       * different files may belong to different chains.
+       */
+      const std::vector<std::string>& trigMatchChains() const
+      { return m_trigMatchChains; }
+
+      /**
+       * Systematic names of a flat scale factor branch (``effSFFlat``), entry ``j``
+       * labels the ``j``-th value of each object. When writing, the first non-empty
+       * list is stored in the tree UserInfo; when reading it is filled by ``setTree``
+       * and again by ``updateEntry`` for each new file of a ``TChain``.
+       */
+      const std::vector<std::string>& flatSFSysNames(const std::string& sfName) const
+      {
+	static const std::vector<std::string> empty;
+	auto sf = m_flatSFs.find(sfName);
+	return sf != m_flatSFs.end() ? sf->second.names : empty;
+      }
+
+      void setFlatSFSysNames(const std::string& sfName, const std::vector<std::string>& sysNames)
+      {
+	auto sf = m_flatSFs.find(sfName);
+	if(sf == m_flatSFs.end() || !sf->second.names.empty() || sysNames.empty()) return;
+	sf->second.names = sysNames;
+	if(sf->second.sysNames) {
+	  for(const std::string& sysName : sysNames) sf->second.sysNames->Add(new TObjString(sysName.c_str()));
+	}
+      }
 
 
     protected:
@@ -174,6 +447,48 @@ namespace xAH
       template<typename T> void setBranch(TTree* tree, std::string varName, std::vector<T>* localVectorPtr){
 	std::string name = branchName(varName);
 	tree->Branch(name.c_str(),        localVectorPtr);
+	addQuantizedBranch(varName, localVectorPtr);
+      }
+
+      //
+      // Reduced precision float branches, rounded in place by quantizeBranches
+      struct QuantizedBranch {
+	std::vector<float>*                values;
+	std::vector< std::vector<float> >* nestedValues;
+	int                                mantissaBits;
+      };
+
+      int mantissaBits(const std::string& varName) const
+      {
+	auto bits = m_varMantissaBits.find(varName);
+	return (bits != m_varMantissaBits.end()) ? bits->second : m_mantissaBits;
+      }
+
+      template<typename T> void addQuantizedBranch(const std::string& /*varName*/, std::vector<T>* /*values*/) {}
+
+      void addQuantizedBranch(const std::string& varName, std::vector<float>* values)
+      {
+	int bits = mantissaBits(varName);
+	if(bits > 0 && bits < 23) m_quantizedBranches.push_back({values, nullptr, bits});
+      }
+
+      void addQuantizedBranch(const std::string& varName, std::vector< std::vector<float> >* values)
+      {
+	int bits = mantissaBits(varName);
+	if(bits > 0 && bits < 23) m_quantizedBranches.push_back({nullptr, values, bits});
+      }
+
+      /// @brief Round ``value`` to the nearest float with ``bits`` mantissa bits; the low bits become zero and compress away
+      static float truncateMantissa(float value, int bits)
+      {
+	uint32_t word;
+	std::memcpy(&word, &value, sizeof(word));
+	if((word & 0x7f800000) == 0x7f800000) return value; // inf, nan
+	const int      drop = 23 - bits;
+	const uint32_t mask = ~((uint32_t(1) << drop) - 1);
+	word = (word + (uint32_t(1) << (drop-1))) & mask;
+	std::memcpy(&value, &word, sizeof(word));
+	return value;
       }
 
       template<typename T, typename U, typename V> void safeFill(const V* xAODObj, SG::AuxElement::ConstAccessor<T>& accessor, std::vector<U>* destination, U defaultValue, int units = 1){
@@ -207,6 +522,236 @@ namespace xAH
         }
       }
 
+      //
+      // Trigger matching as a bitmask with one bit per chain. The chain names are
+      // written once, as a named list of TObjString in the tree UserInfo.
+      void setTrigMatchMaskBranch(TTree* tree)
+      {
+	m_trigMatchMask = new std::vector<ULong64_t>();
+	setBranch<ULong64_t>(tree, "trigMatchMask", m_trigMatchMask);
+
+	m_trigMatchChainList = new TList();
+	m_trigMatchChainList->SetName(branchName("trigMatchChains").c_str());
+	tree->GetUserInfo()->Add(m_trigMatchChainList); // owned by the tree
+      }
+
+      void connectTrigMatchMaskBranch(TTree* tree)
+      {
+	connectBranch<ULong64_t>(tree, "trigMatchMask", &m_trigMatchMask);
+	m_readTrigMatchChains = true;
+	connectUserInfo(tree);
+      }
+
+      void fillTrigMatchMask(const std::map<std::string,char>* matches)
+      {
+	ULong64_t mask = 0;
+	if(matches) {
+	  for(const auto& match : *matches) {
+	    unsigned int id = trigMatchChainId(match.first);
+	    if(match.second && id < 64) mask |= (1ULL << id);
+	  }
+	}
+	m_trigMatchMask->push_back(mask);
+      }
+
+      unsigned int trigMatchChainId(const std::string& chainName)
+      {
+	auto it = m_trigMatchChainIds.find(chainName);
+	if(it != m_trigMatchChainIds.end()) return it->second;
+
+	unsigned int id = m_trigMatchChains.size();
+	if(id == 64) std::cerr << "WARNING! More than 64 trigger chains in " << branchName("trigMatchMask") << ", the extra chains are not stored." << std::endl;
+	m_trigMatchChainIds[chainName] = id;
+	m_trigMatchChains.push_back(chainName);
+	if(m_trigMatchChainList && id < 64) m_trigMatchChainList->Add(new TObjString(chainName.c_str()));
+	return id;
+      }
+
+      // one flat scale factor branch
+      struct FlatSF {
+	std::vector<float>*      values   = nullptr;
+	TList*                   sysNames = nullptr;
+	std::vector<std::string> names;
+	unsigned int             stride   = 0;
+	unsigned int             pending  = 0;
+      };
+
+      //
+      // Scale factors as one flat vector<float> per branch, m_n x stride values. The
+      // systematic names are written once, as a named list of TObjString in the tree
+      // UserInfo. The stride is the number of names, or the size of the first
+      // decorated object when no names were given.
+      //
+      // The branches are also listed in m_flatSFOrder, in the order of the calls since
+      // setTree/setBranches, so the derived containers fill and read them by position
+      // instead of looking them up by name for every object.
+      void setFlatSFBranch(TTree* tree, const std::string& sfName)
+      {
+	FlatSF& sf = flatSFEntry(sfName);
+	sf.values = new std::vector<float>();
+	setBranch<float>(tree, sfName, sf.values);
+
+	sf.sysNames = new TList();
+	sf.sysNames->SetName(branchName(sfName+"_sysNames").c_str());
+	tree->GetUserInfo()->Add(sf.sysNames); // owned by the tree
+      }
+
+      void connectFlatSFBranch(TTree* tree, const std::string& sfName)
+      {
+	FlatSF& sf = flatSFEntry(sfName);
+	connectBranch<float>(tree, sfName, &sf.values);
+	connectUserInfo(tree);
+      }
+
+      FlatSF& flatSFEntry(const std::string& sfName)
+      {
+	FlatSF& sf = m_flatSFs[sfName];
+	m_flatSFOrder.push_back(&sf);
+	return sf;
+      }
+
+      template<typename V> void fillFlatSF(const V* xAODObj, SG::AuxElement::ConstAccessor<std::vector<float> >& accessor, FlatSF& sf, bool quantize)
+      {
+	const std::vector<float>* sfs = accessor.isAvailable(*xAODObj) ? &accessor(*xAODObj) : nullptr;
+
+	if(sf.stride == 0) {
+	  if(!m_storeSystSFs)         sf.stride = 1;
+	  else if(!sf.names.empty())  sf.stride = sf.names.size();
+	  else if(sfs)                sf.stride = sfs->size();
+
+	  // objects of this event seen before the stride was known
+	  if(sf.stride == 0) { sf.pending++; return; }
+	  sf.values->insert(sf.values->begin(), sf.pending*sf.stride, -1.0);
+	  sf.pending = 0;
+	}
+
+	for(unsigned int i = 0; i < sf.stride; i++) {
+	  float value = (sfs && i < sfs->size()) ? (*sfs)[i] : -1.0;
+	  sf.values->push_back( quantize ? quantizeSF(value) : value );
+	}
+      }
+
+      //
+      // Names stored in the tree UserInfo, read from the file of the current entry
+      void connectUserInfo(TTree* tree)
+      {
+	m_infoTree = tree;
+	readUserInfo();
+      }
+
+      void readUserInfo()
+      {
+	m_infoTreeNumber = m_infoTree->GetTreeNumber();
+	// for a TChain the lists live in the trees of the files
+	TTree* infoTree = m_infoTree->GetTree() ? m_infoTree->GetTree() : m_infoTree;
+
+	if(m_readTrigMatchChains) {
+	  m_trigMatchChains.clear();
+	  TList* chainList = dynamic_cast<TList*>(infoTree->GetUserInfo()->FindObject(branchName("trigMatchChains").c_str()));
+	  if(chainList) {
+	    for(const TObject* chain : *chainList) m_trigMatchChains.push_back(chain->GetName());
+	  }
+	}
+
+	for(auto& sf : m_flatSFs) {
+	  sf.second.names.clear();
+	  TList* sysNames = dynamic_cast<TList*>(infoTree->GetUserInfo()->FindObject(branchName(sf.first+"_sysNames").c_str()));
+	  if(sysNames) {
+	    for(const TObject* sysName : *sysNames) sf.second.names.push_back(sysName->GetName());
+	  }
+	  sf.second.stride = sf.second.names.size();
+	}
+      }
+
+      void clearFlatSFs()
+      {
+	for(auto& sf : m_flatSFs) {
+	  if(sf.second.values) sf.second.values->clear();
+	  sf.second.pending = 0;
+	}
+      }
+
+      std::vector<float> flatSF(const FlatSF& sf, uint idx) const
+      {
+	if(!sf.values) return std::vector<float>(1, -1.0);
+	unsigned int stride = sf.stride;
+	if(stride == 0 && m_n > 0) stride = sf.values->size() / m_n;
+	if(stride == 0 || (idx+1)*stride > sf.values->size()) return std::vector<float>(1, -1.0);
+	return std::vector<float>(sf.values->begin() + idx*stride, sf.values->begin() + (idx+1)*stride);
+      }
+
+      // round to 16 significant bits, the dropped bits compress to nothing
+      static float quantizeSF(float value)
+      {
+	return truncateMantissa(value, 15);
+      }
+
+      void checkNotLazy(const char* method) const
+      {
+	if(m_lazy) throw std::logic_error("ParticleContainer::" + std::string(method) + " of " + m_name + " is not available in lazy mode, use view() or column()");
+      }
+
+      //
+      // Structure-of-arrays kinematics
+      enum SoADerived { SoAMomenta = 1, SoAMass = 2, SoAEnergy = 4 };
+
+      const std::vector<float>& kinematic(ColumnHandle<float>& lazy, std::vector<float>* eager)
+      {
+	if(m_lazy) return lazy.values();
+	static const std::vector<float> empty;
+	return eager ? *eager : empty;
+      }
+
+      void updateMomenta()
+      {
+	if(m_soaDerived & SoAMomenta) return;
+	const std::vector<float>& pt = this->pt(); const std::vector<float>& eta = this->eta(); const std::vector<float>& phi = this->phi();
+	std::size_t n = std::min(pt.size(), std::min(eta.size(), phi.size()));
+	m_soaPx.resize(n); m_soaPy.resize(n); m_soaPz.resize(n);
+	for(std::size_t i = 0; i < n; i++) {
+	  m_soaPx[i] = pt[i]*std::cos(phi[i]);
+	  m_soaPy[i] = pt[i]*std::sin(phi[i]);
+	  m_soaPz[i] = pt[i]*std::sinh(eta[i]);
+	}
+	m_soaDerived |= SoAMomenta;
+      }
+
+      //
+      // Lazily connected branches
+      struct LazyColumnBase {
+	virtual ~LazyColumnBase() {}
+	virtual bool connect(TTree* tree, const std::string& name) = 0;
+      };
+      template<typename T> struct LazyColumn : public LazyColumnBase {
+	std::vector<T>* values = new std::vector<T>();
+	~LazyColumn() { delete values; }
+	bool connect(TTree* tree, const std::string& name)
+	{
+	  if(!tree->GetBranch(name.c_str())) return false;
+	  tree->SetBranchStatus  (name.c_str(), 1);
+	  tree->SetBranchAddress (name.c_str(), &values);
+	  return true;
+	}
+      };
+
+      template<typename T> LazyColumnBase* connectLazyColumn(const std::string& varName)
+      {
+	LazyColumn<T>* column = new LazyColumn<T>();
+	std::string name = branchName(varName);
+	if(!m_lazyTree || !column->connect(m_lazyTree, name)) {
+	  std::cerr << "WARNING! Branch " << name << " is not available for lazy reading." << std::endl;
+	  return column;
+	}
+
+	// used after the learning window, the cache has to be told
+	if(m_treeCacheSize > 0 && m_lazyEntries >= m_treeCacheLearnEntries) m_lazyTree->AddBranchToCache(name.c_str(), true);
+
+	// the current entry was read while the branch was disabled
+	TTree* tree = m_lazyTree->GetTree() ? m_lazyTree->GetTree() : m_lazyTree;
+	if(tree->GetReadEntry() >= 0) tree->GetBranch(name.c_str())->GetEntry(tree->GetReadEntry());
+	return column;
+      }
+
       virtual void updateParticle(uint idx, T_PARTICLE& particle)
       {
         if(m_infoSwitch.m_kinematic)
@@ -230,10 +775,54 @@ namespace xAH
 
       std::vector<T_PARTICLE> m_particles;
 
+      // trigger matching bitmask
+      std::vector<ULong64_t>*                       m_trigMatchMask;
+      std::vector<std::string>                      m_trigMatchChains;
+      std::unordered_map<std::string, unsigned int> m_trigMatchChainIds;
+      TList*                                        m_trigMatchChainList;
+
+      // flat scale factors
+      std::map<std::string, FlatSF>                 m_flatSFs;
+      std::vector<FlatSF*>                          m_flatSFOrder;
+
+      // reading the names in the UserInfo of each file
+      TTree*                                        m_infoTree;
+      int                                           m_infoTreeNumber;
+      bool                                          m_readTrigMatchChains;
+
+      // lazy reading
+      TTree*                                        m_lazyTree;
+      int                                           m_lazyEntries;
+
+      // structure-of-arrays kinematics computed in the current entry
+      unsigned int                                  m_soaDerived;
+      std::vector<float>                            m_soaPx;
+      std::vector<float>                            m_soaPy;
+      std::vector<float>                            m_soaPz;
+      std::vector<float>                            m_soaM;
+      std::vector<float>                            m_soaE;
+      std::map<std::string, LazyColumnBase*>        m_lazyColumns;
+      ColumnHandle<float>                           m_lazyPt {this, "pt" };
+      ColumnHandle<float>                           m_lazyEta{this, "eta"};
+      ColumnHandle<float>                           m_lazyPhi{this, "phi"};
+      ColumnHandle<float>                           m_lazyM  {this, "m"  };
+      ColumnHandle<float>                           m_lazyE  {this, "E"  };
+      std::vector<QuantizedBranch>                  m_quantizedBranches;
+
     public:
       T_INFOSWITCH m_infoSwitch;
       bool m_mc;
       bool m_debug;
+      /// @brief Read lazily (set before ``setTree``): only the counter is connected, other branches are disabled until used through ``column`` or ``view``, and ``updateEntry`` does not build the particles
+      bool m_lazy;
+      /// @brief ``TTreeCache`` size in bytes set by ``setTree``, 0 keeps the tree's default
+      Long64_t m_treeCacheSize;
+      /// @brief Number of entries the ``TTreeCache`` learns the used branches from; in lazy mode learning stops after them
+      int m_treeCacheLearnEntries;
+      /// @brief Mantissa bits kept for float branches written by ``setBranch``, 0 keeps full precision; see ``quantizeBranches``
+      int m_mantissaBits;
+      /// @brief Per-variable overrides of ``m_mantissaBits``, set before ``setBranches``
+      std::map<std::string, int> m_varMantissaBits;
       float m_units;
       bool m_storeSystSFs;
 
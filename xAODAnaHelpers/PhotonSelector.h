@@ -3,6 +3,7 @@
 
 // algorithm wrapper
 #include <xAODAnaHelpers/Algorithm.h>
+#include <xAODAnaHelpers/CutflowCounter.h>
 #include <xAODTracking/VertexContainer.h>
 #include <xAODEgamma/PhotonContainer.h>
 
@@ -77,6 +78,7 @@ private:
   /* object-level cutflow */
 
   TH1D* m_ph_cutflowHist_1 = nullptr;            //!
+  xAH::CutflowCounter m_ph_cutflowCounter_1; //!
 
   int   m_ph_cutflow_all;              //!
   int   m_ph_cutflow_author_cut;       //!
@@ -20,6 +20,7 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
 
 class TauSelector : public xAH::Algorithm
 {
@@ -99,7 +100,9 @@ private:
 
   // object cutflow
   TH1D* m_tau_cutflowHist_1;                //!
+  xAH::CutflowCounter m_tau_cutflowCounter_1; //!
   TH1D* m_tau_cutflowHist_2;                //!
+  xAH::CutflowCounter m_tau_cutflowCounter_2; //!
 
   int   m_tau_cutflow_all;		    //!
   int   m_tau_cutflow_selected;             //!
@@ -0,0 +1,62 @@
+#ifndef xAODAnaHelpers_TrackSelectionCache_H
+#define xAODAnaHelpers_TrackSelectionCache_H
+
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+
+#include "xAODTracking/TrackParticle.h"
+#include "xAODTracking/Vertex.h"
+
+namespace xAH {
+
+  /**
+   * Per-event cache of track selection decisions, indexed by the index of the
+   * track in its container. Tracks are ghost-associated to several jet
+   * collections in the same event, so the decision of an expensive selection
+   * is computed once per track and event. The cache is reset whenever
+   * ``newEvent`` is called with a different run and event number or primary
+   * vertex. The event number is needed because the input vertex and track
+   * containers are the same objects from one event to the next.
+   */
+  class TrackSelectionCache
+  {
+  public:
+    enum Decision { Unknown = -1, Fail = 0, Pass = 1 };
+
+    TrackSelectionCache() : m_runNumber(0), m_eventNumber(0), m_pv(nullptr) {}
+
+    void newEvent(uint32_t runNumber, unsigned long long eventNumber, const xAOD::Vertex* pv)
+    {
+      if( !m_decisions.empty() && runNumber == m_runNumber && eventNumber == m_eventNumber && pv == m_pv ) return;
+      m_runNumber   = runNumber;
+      m_eventNumber = eventNumber;
+      m_pv          = pv;
+      m_decisions.clear();
+    }
+
+    void clear() { m_decisions.clear(); }
+
+    Decision decision(const xAOD::TrackParticle* track) const
+    {
+      auto decisions = m_decisions.find(track->container());
+      if( decisions == m_decisions.end() || track->index() >= decisions->second.size() ) return Unknown;
+      return static_cast<Decision>(decisions->second[track->index()]);
+    }
+
+    void setDecision(const xAOD::TrackParticle* track, bool pass)
+    {
+      std::vector<char>& decisions = m_decisions[track->container()];
+      if( track->index() >= decisions.size() ) decisions.resize(track->index()+1, Unknown);
+      decisions[track->index()] = pass ? Pass : Fail;
+    }
+
+  private:
+    uint32_t            m_runNumber;
+    unsigned long long  m_eventNumber;
+    const xAOD::Vertex* m_pv;
+    std::unordered_map<const SG::AuxVectorData*, std::vector<char> > m_decisions;
+  };
+
+}//xAH
+#endif // xAODAnaHelpers_TrackSelectionCache_H
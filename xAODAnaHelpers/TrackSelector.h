@@ -9,6 +9,8 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
+#include "xAODAnaHelpers/TrackSelectionCache.h"
 
 class TrackSelector : public xAH::Algorithm
 {
@@ -76,9 +78,13 @@ private:
   int m_numEventPass;     //!
   int m_numObjectPass;    //!
 
+  // decisions of the tracks in jets, a track can be in several jets
+  xAH::TrackSelectionCache m_trkSelCache; //!
+
   // cutflow
   TH1D* m_cutflowHist = nullptr;          //!
   TH1D* m_cutflowHistW = nullptr;         //!
+  xAH::CutflowCounter m_cutflowCounter; //!
   int   m_cutflow_bin;          //!
 
   // variables that don't get filled at submission time should be
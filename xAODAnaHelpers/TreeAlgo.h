@@ -4,6 +4,7 @@
 #include "TTree.h"
 
 #include <xAODAnaHelpers/HelpTreeBase.h>
+#include <xAODAnaHelpers/NtupleEventIndex.h>
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
@@ -58,6 +59,8 @@ public:
   std::string m_l1JetContainerName = "";
   bool m_sortL1Jets = false;
   bool m_retrievePV = true;
+  /// @brief write a sorted (runNumber, eventNumber) to (tree, entry) index next to the trees, see :cpp:class:`NtupleEventIndex`
+  bool m_writeEventIndex = false;
 
   // if these are set, assume systematics are being processed over
   std::string m_muSystsVec = "";
@@ -91,6 +94,7 @@ protected:
   std::vector<std::string> m_clusterBranches; //!
 
   std::map<std::string, HelpTreeBase*> m_trees;            //!
+  NtupleEventIndex* m_eventIndex = nullptr;                //!
 
 public:
 
@@ -28,6 +28,12 @@ namespace xAH {
       virtual void clear();
       virtual void FillTruth( const xAOD::TruthParticle* truth );
       virtual void FillTruth( const xAOD::IParticle* particle );
+      /**
+       * With ``flatLinks``, replace the truth-container indices stored for the parent/child links
+       * of the particles filled so far by their positions in this collection (-1 if not filled).
+       * Call once all particles of the event are filled.
+       */
+      virtual void FillTruthLinks();
       using ParticleContainer::setTree; // make other overloaded version of execute() to show up in subclass
 
     protected:
@@ -36,6 +42,9 @@ namespace xAH {
 
     private:
 
+      int  linkIndex( const xAOD::TruthParticle* link ) const;
+      void resolveLinks( std::vector<int>* indices, size_t& nResolved ) const;
+
 
       //
       // Vector branches
@@ -67,6 +76,18 @@ namespace xAH {
       std::vector< std::vector<int> >* m_child_barcode;
       std::vector< std::vector<int> >* m_child_status;
 
+      // flatLinks: per particle the first entry in the flat index vector
+      std::vector<int>* m_parent_begin;
+      std::vector<int>* m_parent_index;
+      std::vector<int>* m_child_begin;
+      std::vector<int>* m_child_index;
+
+      // flatLinks: truth-container index -> position in this collection for the current event
+      const SG::AuxVectorData* m_linkContainer;
+      std::vector<int>         m_outputIndex;
+      size_t                   m_nParentsResolved;
+      size_t                   m_nChildrenResolved;
+
     };
 }
 
@@ -29,12 +29,14 @@ namespace xAH {
       std::vector<int> parent_pdgId;
       std::vector<int> parent_barcode;
       std::vector<int> parent_status;
+      std::vector<int> parent_index; // flatLinks: positions of the parents in the collection
 
       // Children
       int nChildren;
       std::vector<int> child_pdgId;
       std::vector<int> child_barcode;
       std::vector<int> child_status;
+      std::vector<int> child_index;  // flatLinks: positions of the children in the collection
 
     };
 
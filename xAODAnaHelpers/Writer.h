@@ -4,6 +4,9 @@
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
 
+#include <map>
+#include <set>
+
 class Writer : public xAH::Algorithm
 {
   // put your configuration variables here as public variables.
@@ -15,6 +18,11 @@ public:
   TString m_electronContainerNamesStr = "";
   TString m_muonContainerNamesStr = "";
 
+  /** write shallow copies in TStore as shallow copies of their input container, i.e. only
+      the variables that were modified or added, when that input container is written as well
+      (configured or copied for another shallow copy); false writes every variable of them */
+  bool m_shallowIO = true;
+
 private:
   int m_numEvent;         //!
 
@@ -22,6 +30,22 @@ private:
   std::vector<TString> m_electronContainerNames;
   std::vector<TString> m_muonContainerNames;
 
+  /// how often each container was written as a copy of the input, a shallow copy or a deep copy
+  struct WriteCounts {
+    unsigned long long copied = 0;
+    unsigned long long shallow = 0;
+    unsigned long long deep = 0;
+  };
+  std::map<std::string, WriteCounts> m_writeCounts; //!
+  /// all configured container names
+  std::set<std::string> m_writeNames; //!
+  /// the input containers already copied to the output in the current event
+  std::set<std::string> m_copiedKeys; //!
+
+  /// write the container ``name`` from TEvent or TStore, together with its aux store
+  template<typename T, typename TAux>
+  EL::StatusCode writeContainer(const std::string& name);
+
   // variables that don't get filled at submission time should be
   // protected from being send from the submission node to the worker
   // node (done by the //!)